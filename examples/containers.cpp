@@ -33,4 +33,5 @@ BENCHMARK_FIXTURE(ContainerFixture<std::deque<int>>, "std::deque<int>.push_back(
     container.push_back(0);
 }
 
+BENCHMARK_ALLOCATIONS()
 BENCHMARK_MAIN()
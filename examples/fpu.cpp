@@ -8,20 +8,23 @@
 
 BENCHMARK("sin()")
 {
-    [[maybe_unused]] static double sum = 0;
-    sum += sin(123.456);
+    double value = 123.456;
+    CppBenchmark::DoNotOptimize(value);
+    CppBenchmark::DoNotOptimize(sin(value));
 }
 
 BENCHMARK("cos()")
 {
-    [[maybe_unused]] static double sum = 0;
-    sum += cos(123.456);
+    double value = 123.456;
+    CppBenchmark::DoNotOptimize(value);
+    CppBenchmark::DoNotOptimize(cos(value));
 }
 
 BENCHMARK("tan()")
 {
-    [[maybe_unused]] static double sum = 0;
-    sum += tan(123.456);
+    double value = 123.456;
+    CppBenchmark::DoNotOptimize(value);
+    CppBenchmark::DoNotOptimize(tan(value));
 }
 
 BENCHMARK_MAIN()
@@ -35,26 +35,24 @@ protected:
 
 BENCHMARK_FIXTURE(MemoryCopyFixture, "memcpy", settings)
 {
-    uint64_t crc = 0;
     size_t size = context.x();
     uint8_t local[chunk_size_to];
-    std::memcpy(local, buffer, size);
-    crc += local[0];
+    uint8_t* destination = CppBenchmark::Launder(local);
+    std::memcpy(destination, buffer, size);
+    CppBenchmark::ClobberMemory();
     context.metrics().AddBytes(size);
-    context.metrics().SetCustom("CRC", crc);
 }
 
 BENCHMARK("memmove", settings)
 {
-    uint64_t crc = 0;
     size_t size = context.x();
-    uint8_t buffer[chunk_size_to];
+    uint8_t local[chunk_size_to];
+    uint8_t* buffer = CppBenchmark::Launder(local);
     std::memset(buffer, 0, size);
     std::memmove(buffer, buffer + size / 4, size / 2);
     std::memmove(buffer + size / 2, buffer + size / 4, size / 2);
-    crc = buffer[0];
+    CppBenchmark::ClobberMemory();
     context.metrics().AddBytes(context.x());
-    context.metrics().SetCustom("CRC", crc);
 }
 
 BENCHMARK_MAIN()
@@ -56,7 +56,7 @@ BENCHMARK_FIXTURE(VirtualFixture, "Inline call", 1)
     for (uint64_t i = 0; i < operations; ++i)
         crc += testers[i % testers.size()]->TestInline((int)i);
     context.metrics().AddOperations(operations - 1);
-    context.metrics().SetCustom("CRC", crc);
+    CppBenchmark::DoNotOptimize(crc);
 }
 
 BENCHMARK_FIXTURE(VirtualFixture, "Direct call", 1)
@@ -65,7 +65,7 @@ BENCHMARK_FIXTURE(VirtualFixture, "Direct call", 1)
     for (uint64_t i = 0; i < operations; ++i)
         crc += testers[i % testers.size()]->TestDirect((int)i);
     context.metrics().AddOperations(operations - 1);
-    context.metrics().SetCustom("CRC", crc);
+    CppBenchmark::DoNotOptimize(crc);
 }
 
 BENCHMARK_FIXTURE(VirtualFixture, "Virtual call", 1)
@@ -74,7 +74,7 @@ BENCHMARK_FIXTURE(VirtualFixture, "Virtual call", 1)
     for (uint64_t i = 0; i < operations; ++i)
         crc += testers[i % testers.size()]->TestVirtual((int)i);
     context.metrics().AddOperations(operations - 1);
-    context.metrics().SetCustom("CRC", crc);
+    CppBenchmark::DoNotOptimize(crc);
 }
 
 BENCHMARK_MAIN()
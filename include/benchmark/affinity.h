@@ -0,0 +1,90 @@
+/*!
+    \file affinity.h
+    \brief Benchmark threads placement definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_AFFINITY_H
+#define CPPBENCHMARK_AFFINITY_H
+
+#include "benchmark/system.h"
+
+#include <vector>
+
+namespace CppBenchmark {
+
+//! Benchmark threads placement policy
+enum class AffinityPolicy
+{
+    None,           //!< Threads are not bound, the scheduler migrates them freely
+    Compact,        //!< Threads fill logical CPUs one by one (SMT siblings first, then cores of the same cache)
+    Scatter,        //!< Threads are spread across physical cores and caches, SMT siblings are used last
+    NoSMT,          //!< Threads are bound to one logical CPU of each physical core only
+    List,           //!< Threads are bound to the explicit list of logical CPUs
+    SameCore,       //!< Producer and consumer pair shares one physical core (SMT siblings)
+    SameCache,      //!< Producer and consumer pair uses different physical cores of the same last level cache
+    DifferentCache  //!< Producer and consumer pair uses physical cores of different last level caches
+};
+
+//! Benchmark threads placement static class
+/*!
+    Plans logical CPUs for benchmark threads according to the placement policy and the CPU topology.
+    If there are more threads than planned CPUs then CPUs are reused in the same order.
+
+    Pair policies (SameCore, SameCache, DifferentCache) place the i-th producer and the i-th consumer
+    of producers/consumers benchmarks as a pair. Threads benchmarks place consecutive threads as pairs.
+    If the topology cannot provide the requested pair (no SMT, single cache) the nearest pair is used:
+    different cores of the same cache for SameCore and different cores for DifferentCache.
+*/
+class Affinity
+{
+public:
+    Affinity() = delete;
+    Affinity(const Affinity&) = delete;
+    Affinity(Affinity&&) = delete;
+    ~Affinity() = delete;
+
+    Affinity& operator=(const Affinity&) = delete;
+    Affinity& operator=(Affinity&&) = delete;
+
+    //! Get placement policy name
+    static const char* Name(AffinityPolicy policy) noexcept;
+
+    //! Plan logical CPUs for threads benchmark
+    /*!
+        \param policy - Placement policy
+        \param topology - CPU topology
+        \param cpus - Explicit list of logical CPUs (used by the List policy)
+        \param threads - Count of threads
+        \return Logical CPU for each thread (-1 if the thread should not be bound)
+    */
+    static std::vector<int> PlanThreads(AffinityPolicy policy, const std::vector<CpuTopology>& topology, const std::vector<int>& cpus, int threads);
+    //! Plan logical CPUs for producers/consumers benchmark
+    /*!
+        \param policy - Placement policy
+        \param topology - CPU topology
+        \param cpus - Explicit list of logical CPUs (used by the List policy)
+        \param producers - Count of producers
+        \param consumers - Count of consumers
+        \return Logical CPU for each producer followed by each consumer (-1 if the thread should not be bound)
+    */
+    static std::vector<int> PlanProducersConsumers(AffinityPolicy policy, const std::vector<CpuTopology>& topology, const std::vector<int>& cpus, int producers, int consumers);
+    //! Plan logical CPUs for parallel jobs of single-threaded benchmarks
+    /*!
+        Each job gets its own physical core and SMT siblings of planned cores stay idle, so the count of
+        planned jobs is limited by the count of physical cores. Spread jobs alternate last level caches
+        to avoid sharing them while there are enough caches.
+
+        \param topology - CPU topology
+        \param jobs - Count of jobs
+        \param spread - Spread jobs across last level caches
+        \return Logical CPU for each planned job (-1 if the job should not be bound)
+    */
+    static std::vector<int> PlanJobs(const std::vector<CpuTopology>& topology, int jobs, bool spread);
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_AFFINITY_H
@@ -0,0 +1,100 @@
+/*!
+    \file allocations.h
+    \brief Heap allocations tracker definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_ALLOCATIONS_H
+#define CPPBENCHMARK_ALLOCATIONS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppBenchmark {
+
+//! Heap allocations counters
+struct AllocationCounters
+{
+    //! Count of allocations
+    int64_t allocations;
+    //! Count of frees
+    int64_t frees;
+    //! Allocated bytes
+    int64_t bytes;
+    //! Live bytes (allocated and not freed yet)
+    int64_t live;
+    //! Peak of live bytes (upper bound for the sum of several threads)
+    int64_t peak;
+};
+
+//! Heap allocations tracker static class
+/*!
+    Tracks heap allocations made with global operator new/delete replaced by BENCHMARK_ALLOCATIONS() macro.
+    Counters are thread-local, so tracking does not serialize benchmark threads. Sizes are taken from the
+    allocator usable size of the memory block, so they include allocator rounding. Memory blocks are
+    accounted by the freeing thread, so live bytes of a thread which frees memory blocks allocated by
+    another thread (e.g. consumers of producers/consumers benchmarks) could be negative.
+
+    Benchmark phases collect allocations counters of the calling thread while the phase is running. Counters of
+    the benchmark with several threads are the sum of its threads counters, so the peak of live bytes is an upper
+    bound of the real peak (threads may reach their peaks at different times).
+*/
+class Allocations
+{
+public:
+    Allocations() = delete;
+    Allocations(const Allocations&) = delete;
+    Allocations(Allocations&&) = delete;
+    ~Allocations() = delete;
+
+    Allocations& operator=(const Allocations&) = delete;
+    Allocations& operator=(Allocations&&) = delete;
+
+    //! Is heap allocations tracking enabled?
+    static bool enabled() noexcept { return _enabled; }
+    //! Enable heap allocations tracking
+    static void Enable() noexcept { _enabled = true; }
+
+    //! Get heap allocations counters of the current thread
+    static AllocationCounters& current() noexcept;
+
+    //! Allocate the memory block and track it
+    /*!
+        \param size - Memory block size
+        \param alignment - Memory block alignment (0 for the default alignment)
+        \return Pointer to the allocated memory block or nullptr
+    */
+    static void* Allocate(size_t size, size_t alignment = 0) noexcept;
+    //! Allocate the memory block and track it in the way of the global operator new
+    /*!
+        Calls the current new handler while the memory block cannot be allocated and throws std::bad_alloc
+        if there is no new handler.
+
+        \param size - Memory block size
+        \param alignment - Memory block alignment (0 for the default alignment)
+        \return Pointer to the allocated memory block
+    */
+    static void* New(size_t size, size_t alignment = 0);
+    //! Allocate the memory block and track it in the way of the global nothrow operator new
+    /*!
+        \param size - Memory block size
+        \param alignment - Memory block alignment (0 for the default alignment)
+        \return Pointer to the allocated memory block or nullptr
+    */
+    static void* NewNoThrow(size_t size, size_t alignment = 0) noexcept;
+    //! Free the memory block and track it
+    /*!
+        \param ptr - Pointer to the memory block (could be nullptr)
+        \param alignment - Memory block alignment (0 for the default alignment)
+    */
+    static void Deallocate(void* ptr, size_t alignment = 0) noexcept;
+
+private:
+    static bool _enabled;
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_ALLOCATIONS_H
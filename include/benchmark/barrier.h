@@ -9,7 +9,9 @@
 #ifndef CPPBENCHMARK_BARRIER_H
 #define CPPBENCHMARK_BARRIER_H
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 
 namespace CppBenchmark {
@@ -19,6 +21,11 @@ namespace CppBenchmark {
     A barrier for a group of threads in the source code means any thread must stop at this point
     and cannot proceed until all other threads reach this barrier.
 
+    Waiting threads spin for a short time (tens of microseconds with the default spin count) before
+    blocking, so they are released within a few hundred nanoseconds when all threads reach the barrier
+    in time. Blocked threads wait on futex in Linux and on condition variable in other platforms.
+    Spinning is disabled on single core systems.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Barrier_(computer_science)
@@ -29,8 +36,9 @@ public:
     //! Default class constructor
     /*!
         \param threads - Count of threads to wait at the barrier
+        \param spin - Count of spin iterations before blocking, 0 to block immediately (default is 1024)
     */
-    explicit Barrier(int threads) noexcept;
+    explicit Barrier(int threads, int64_t spin = 1024) noexcept;
     Barrier(const Barrier&) = delete;
     Barrier(Barrier&&) = delete;
     ~Barrier() = default;
@@ -49,9 +57,13 @@ public:
 private:
     std::mutex _mutex;
     std::condition_variable _cond;
-    int _counter;
-    int _generation;
+    std::atomic<int> _counter;
+    std::atomic<int> _generation;
     int _threads;
+    int64_t _spin;
+
+    void Block(int generation) noexcept;
+    void Release() noexcept;
 };
 
 } // namespace CppBenchmark
@@ -55,7 +55,7 @@ protected:
 
 private:
     int CountLaunches() const override;
-    void Launch(int& current, int total, LauncherHandler& handler) override;
+    void Launch(int& current, int& total, ClockType clock, LauncherHandler& handler) override;
 };
 
 /*! \example atomic.cpp Atomic operations benchmark */
@@ -12,6 +12,13 @@
 #include "benchmark/context.h"
 #include "benchmark/phase_core.h"
 #include "benchmark/settings.h"
+#include "benchmark/system.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <thread>
 
 namespace CppBenchmark {
 
@@ -42,7 +49,7 @@ public:
         \param settings - Benchmark settings
     */
     explicit BenchmarkBase(const std::string& name, const Settings& settings)
-        : _launched(false), _name(name), _settings(settings)
+        : _launched(false), _name(name), _settings(settings), _clock(ClockType::Monotonic)
     {}
     BenchmarkBase(const BenchmarkBase&) = delete;
     BenchmarkBase(BenchmarkBase&&) = delete;
@@ -55,6 +62,8 @@ public:
     const std::string& name() const { return _name; }
     //! Get benchmark settings
     const Settings& settings() const { return _settings; }
+    //! Get timestamp clock resolved for the last benchmark launch
+    ClockType clock() const noexcept { return _clock; }
 
 protected:
     //! Benchmark launched flag
@@ -63,6 +72,8 @@ protected:
     std::string _name;
     //! Benchmark settings
     Settings _settings;
+    //! Benchmark timestamp clock
+    ClockType _clock;
     //! Benchmark phases
     std::vector<std::shared_ptr<PhaseCore>> _phases;
 
@@ -74,11 +85,15 @@ protected:
 
     //! Get the count of benchmark launches
     /*!
+        In adaptive attempts mode the total benchmarks count is an estimate and it will be increased
+        by launches of each extra attempt.
+
         \param current - Current benchmark number
         \param total - Total benchmarks
+        \param clock - Timestamp clock resolved by the launcher
         \param handler - Launcher handler
     */
-    virtual void Launch(int& current, int total, LauncherHandler& handler) {}
+    virtual void Launch(int& current, int& total, ClockType clock, LauncherHandler& handler) {}
 
     //! Initialize benchmark context
     /*!
@@ -86,6 +101,122 @@ protected:
     */
     void InitBenchmarkContext(Context& context);
 
+    //! Run benchmark operations
+    /*!
+        Prepares benchmark operations and measures them with the same parameters.
+        In batched execution mode the operation method is called several times between timestamps
+        and stop predicate checks.
+
+        \param context - Benchmark context
+        \param infinite - Infinite operations flag
+        \param duration - Benchmark duration in seconds (0 to use the given count of operations)
+        \param operations - Count of operations
+        \param batched - Batched execution flag
+        \param paced - Open-loop execution flag (used only if the target operations rate is set)
+        \param run - Benchmark operation method
+        \param stopped - Benchmark stop predicate
+    */
+    template <class TRun, class TStopped>
+    void RunOperations(Context& context, bool infinite, int64_t duration, int64_t operations, bool batched, bool paced, TRun run, TStopped stopped);
+    //! Prepare benchmark operations
+    /*!
+        Initializes metrics collection of the current phase, warms up benchmark operations, calculates the batch
+        size of operations and calibrates the harness overhead. Multi-thread benchmarks prepare operations of each
+        thread before the start barrier, so the measured loops of all threads start at the same time.
+
+        \param context - Benchmark context
+        \param infinite - Infinite operations flag
+        \param duration - Benchmark duration in seconds (0 to use the given count of operations)
+        \param operations - Count of operations
+        \param batched - Batched execution flag
+        \param paced - Open-loop execution flag (used only if the target operations rate is set)
+        \param run - Benchmark operation method
+        \param stopped - Benchmark stop predicate
+        \return Batch size of operations
+    */
+    template <class TRun, class TStopped>
+    int64_t PrepareOperations(Context& context, bool infinite, int64_t duration, int64_t operations, bool batched, bool paced, TRun run, TStopped stopped);
+    //! Measure benchmark operations
+    /*!
+        Runs the benchmark operations loop collecting metrics of the current phase.
+
+        \param context - Benchmark context
+        \param infinite - Infinite operations flag
+        \param duration - Benchmark duration in seconds (0 to use the given count of operations)
+        \param operations - Count of operations
+        \param batch - Batch size of operations
+        \param paced - Open-loop execution flag (used only if the target operations rate is set)
+        \param run - Benchmark operation method
+        \param stopped - Benchmark stop predicate
+    */
+    template <class TRun, class TStopped>
+    void MeasureOperations(Context& context, bool infinite, int64_t duration, int64_t operations, int64_t batch, bool paced, TRun run, TStopped stopped);
+    //! Run benchmark operations loop
+    /*!
+        Timed operations loop runs until the deadline. The clock is checked every few batches and the check
+        interval grows while checks are more frequent than once per millisecond.
+
+        \param phase - Benchmark phase to collect metrics
+        \param infinite - Infinite operations flag
+        \param duration - Duration of the operations loop in nanoseconds (0 to use the given count of operations)
+        \param operations - Count of operations
+        \param batch - Batch size of operations
+        \param run - Benchmark operation method
+        \param stopped - Benchmark stop predicate
+    */
+    template <class TRun, class TStopped>
+    void RunOperationsLoop(PhaseCore& phase, bool infinite, int64_t duration, int64_t operations, int64_t batch, TRun run, TStopped stopped);
+    //! Run benchmark operations loop at the target operations rate
+    /*!
+        Open-loop operations loop starts each operation at its intended start time according to the target
+        operations rate (constant or Poisson inter-arrival times) regardless of how long previous operations
+        took. Latency of each operation is measured from its intended start time, so stalls are not hidden
+        by the delayed start of following operations (coordinated omission).
+
+        \param phase - Benchmark phase to collect metrics
+        \param infinite - Infinite operations flag
+        \param duration - Duration of the operations loop in nanoseconds (0 to use the given count of operations)
+        \param operations - Count of operations
+        \param run - Benchmark operation method
+        \param stopped - Benchmark stop predicate
+    */
+    template <class TRun, class TStopped>
+    void RunOperationsPaced(PhaseCore& phase, bool infinite, int64_t duration, int64_t operations, TRun run, TStopped stopped);
+
+    //! Calculate the batch size of operations
+    /*!
+        Doubles the batch size until the batch duration is well above the timestamp clock resolution.
+        With the fixed count of operations calibration runs at most the same count of uncounted operations
+        and the batch size does not exceed it.
+
+        \param run - Benchmark operation method
+        \param stopped - Benchmark stop predicate
+        \param operations - Fixed count of operations (0 if operations are not limited)
+        \return Batch size of operations
+    */
+    template <class TRun, class TStopped>
+    int64_t CalibrateBatch(TRun run, TStopped stopped, int64_t operations);
+    //! Calibrate the harness overhead
+    /*!
+        Runs the empty operation through the benchmark operations loop and stores the best measured
+        overhead into the current phase metrics.
+
+        \param context - Benchmark context
+        \param batch - Batch size of operations
+        \param stopped - Benchmark stop predicate
+    */
+    template <class TStopped>
+    void CalibrateOverhead(Context& context, int64_t batch, TStopped stopped);
+
+    //! Empty benchmark operation used to calibrate the harness overhead
+    /*!
+        Empty operation is called through the virtual dispatch in the same way as the benchmark
+        run method, so the calibrated overhead includes the cost of the virtual call.
+
+        \param context - Benchmark context
+    */
+    virtual void EmptyOperation(Context& context);
+
     //! Update benchmark metrics for the given benchmark phases collection
     /*!
         \param phases - Benchmark phases collection
@@ -103,6 +234,88 @@ protected:
     */
     static void UpdateBenchmarkThreads(std::vector<std::shared_ptr<PhaseCore>>& phases);
 
+    //! Update benchmark performance counters for the given benchmark phases collection
+    /*!
+        Root phase without own performance counters will sum performance counters of its child phases
+        collected in benchmark threads.
+
+        \param phases - Benchmark phases collection
+    */
+    static void UpdateBenchmarkCounters(std::vector<std::shared_ptr<PhaseCore>>& phases);
+
+    //! Update benchmark resources usage for the given benchmark phases collection
+    /*!
+        Root phase without own resources usage will sum resources usage of its child phases collected
+        in benchmark threads.
+
+        \param phases - Benchmark phases collection
+    */
+    static void UpdateBenchmarkResources(std::vector<std::shared_ptr<PhaseCore>>& phases);
+
+    //! Update benchmark heap allocations for the given benchmark phases collection
+    /*!
+        Root phase will add heap allocations of its child phases collected in benchmark threads to its own
+        heap allocations of the launching thread. Memory blocks freed by another thread are accounted by the
+        freeing thread, so live bytes of a single thread could be negative while the combined live bytes
+        are balanced. Combined peak is the sum of thread peaks, so it is an upper bound of the real peak.
+
+        \param phases - Benchmark phases collection
+    */
+    static void UpdateBenchmarkAllocations(std::vector<std::shared_ptr<PhaseCore>>& phases);
+
+    //! Update benchmark latency for the given benchmark phases collection
+    /*!
+        Root phase will combine latency histograms of its child phases with the given name prefix
+        collected in benchmark threads.
+
+        \param phases - Benchmark phases collection
+        \param prefix - Name prefix of child phases to combine
+    */
+    static void UpdateBenchmarkLatency(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix);
+
+    //! Update benchmark interval snapshots for the given benchmark phases collection
+    /*!
+        Root phase will combine interval snapshots with the same index of its child phases with the given
+        name prefix collected in benchmark threads.
+
+        \param phases - Benchmark phases collection
+        \param prefix - Name prefix of child phases to combine
+    */
+    static void UpdateBenchmarkIntervals(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix);
+
+    //! Update benchmark samples for the given benchmark phases collection
+    /*!
+        Root phase will combine samples of its child phases with the given name prefix collected in benchmark
+        threads. Each sample keeps the Id of the thread which collected it.
+
+        \param phases - Benchmark phases collection
+        \param prefix - Name prefix of child phases to combine
+    */
+    static void UpdateBenchmarkSamples(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix);
+
+    //! Update benchmark threads fairness for the given benchmark phases collection
+    /*!
+        Root phase will collect operations throughput of its child phases with the given name prefix
+        (one child phase per benchmark thread of the same role) and estimate their fairness. Fairness
+        is estimated with attempts of all threads made in the same launch and averaged over launches.
+
+        \param phases - Benchmark phases collection
+        \param prefix - Name prefix of child phases of benchmark threads
+    */
+    static void UpdateBenchmarkFairness(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix);
+
+    //! Update start skew and overlap window of benchmark threads for the given benchmark launch metrics
+    /*!
+        Overlap window starts when the last thread passed the start barrier and stops when the first thread
+        finished its operations. Operations in the overlap window are estimated assuming each thread runs
+        its operations at a constant rate.
+
+        \param metrics - Benchmark launch metrics
+        \param running - Start timestamp, stop timestamp and operations of each benchmark thread
+        \param operations - Estimate operations in the overlap window
+    */
+    static void UpdateBenchmarkOverlap(PhaseMetrics& metrics, const std::vector<std::tuple<int64_t, int64_t, int64_t>>& running, bool operations);
+
     //! Update benchmark names for the given benchmark phases collection
     /*!
         \param phases - Benchmark phases collection
@@ -125,8 +338,40 @@ protected:
         \param phase - Benchmark phase
     */
     static void UpdateBenchmarkOperations(PhaseCore& phase);
+
+    //! Check if benchmark results converged after the given attempt
+    /*!
+        Results converge when the minimal count of attempts is made and the relative width of the throughput
+        confidence interval of every root phase is less than the target precision. Results of the maximal
+        attempt are always treated as converged.
+
+        Root phases of threads and producers/consumers benchmarks count a single operation per launch,
+        so their attempts throughput is calculated from operations of benchmark threads child phases.
+
+        \param phases - Benchmark phases collection
+        \param settings - Benchmark settings
+        \param attempt - Benchmark attempt
+        \param threads - Calculate throughput from operations of benchmark threads (default is false)
+        \return 'true' if no more attempts are required, 'false' otherwise
+    */
+    static bool IsBenchmarkConverged(const std::vector<std::shared_ptr<PhaseCore>>& phases, const Settings& settings, int attempt, bool threads = false);
+
+    //! Update benchmark statistics for the given benchmark phases collection
+    /*!
+        \param phases - Benchmark phases collection
+        \param settings - Benchmark settings
+    */
+    static void UpdateBenchmarkStatistics(std::vector<std::shared_ptr<PhaseCore>>& phases, const Settings& settings);
+    //! Update benchmark statistics for the given benchmark phase
+    /*!
+        \param phase - Benchmark phase
+        \param settings - Benchmark settings
+    */
+    static void UpdateBenchmarkStatistics(PhaseCore& phase, const Settings& settings);
 };
 
 } // namespace CppBenchmark
 
+#include "benchmark_base.inl"
+
 #endif // CPPBENCHMARK_BENCHMARK_BASE_H
@@ -0,0 +1,310 @@
+/*!
+    \file benchmark_base.inl
+    \brief Benchmark base inline implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppBenchmark {
+
+template <class TRun, class TStopped>
+inline void BenchmarkBase::RunOperations(Context& context, bool infinite, int64_t duration, int64_t operations, bool batched, bool paced, TRun run, TStopped stopped)
+{
+    int64_t batch = PrepareOperations(context, infinite, duration, operations, batched, paced, run, stopped);
+    MeasureOperations(context, infinite, duration, operations, batch, paced, run, stopped);
+}
+
+template <class TRun, class TStopped>
+inline int64_t BenchmarkBase::PrepareOperations(Context& context, bool infinite, int64_t duration, int64_t operations, bool batched, bool paced, TRun run, TStopped stopped)
+{
+    // Initialize samples buffer of the current phase
+    if (_settings.samples() > 0)
+        context._current->InitSamples(_settings.samples(), _settings.samples_reservoir());
+
+    // Initialize interval snapshots of the current phase
+    if (_settings.intervals() > 0)
+        context._current->InitIntervals(_settings.intervals() * 1000000, _settings.intervals_capacity());
+
+    // Open performance counters of the current phase for the current thread
+    if (_settings.counters())
+        context._current->InitCounters();
+
+    // Collect resources usage of the current phase
+    if (_settings.resources())
+        context._current->InitResources();
+
+    // Open-loop execution at the target operations rate
+    bool open = paced && (_settings.rate() > 0);
+
+    // Warm up benchmark operations and discard results (at the target operations rate in the open-loop mode)
+    if ((_settings.warmup() > 0) || (_settings.warmup_duration() > 0))
+    {
+        PhaseCore warmup("warmup");
+        if (open)
+            RunOperationsPaced(warmup, false, _settings.warmup_duration() * 1000000, _settings.warmup(), run, stopped);
+        else
+            RunOperationsLoop(warmup, false, _settings.warmup_duration() * 1000000, _settings.warmup(), 1, run, stopped);
+    }
+
+    // Calculate the batch size of operations (batched execution is ignored in the open-loop mode)
+    int64_t batch = 1;
+    if (batched && !open)
+        batch = (_settings.batch() > 0) ? _settings.batch() : CalibrateBatch(run, stopped, (infinite || (duration > 0)) ? 0 : operations);
+
+    // Calibrate the harness overhead
+    if (_settings.overhead())
+        CalibrateOverhead(context, batch, stopped);
+
+    return batch;
+}
+
+template <class TRun, class TStopped>
+inline void BenchmarkBase::MeasureOperations(Context& context, bool infinite, int64_t duration, int64_t operations, int64_t batch, bool paced, TRun run, TStopped stopped)
+{
+    // Run benchmark operations in the open-loop or the closed-loop mode
+    if (paced && (_settings.rate() > 0))
+        RunOperationsPaced(*context._current, infinite, duration * 1000000000, operations, run, stopped);
+    else
+        RunOperationsLoop(*context._current, infinite, duration * 1000000000, operations, batch, run, stopped);
+}
+
+template <class TRun, class TStopped>
+inline void BenchmarkBase::RunOperationsLoop(PhaseCore& phase, bool infinite, int64_t duration, int64_t operations, int64_t batch, TRun run, TStopped stopped)
+{
+    bool latency_auto = _settings.latency_auto();
+    bool sampling = (_settings.samples() > 0);
+    bool timing = latency_auto || sampling;
+    ClockType clock = _clock;
+
+    PhaseMetrics& metrics = phase.current();
+
+    bool timed = (duration > 0);
+    bool intervals = (metrics._interval_period > 0);
+    bool checking = timed || intervals;
+    const int64_t limit = 1 << 20;
+
+    uint64_t timestamp = 0;
+
+    // Deadline of the timed operations loop
+    uint64_t deadline = 0;
+    uint64_t checkstamp = 0;
+    int64_t interval = 1;
+    int64_t countdown = 1;
+
+    phase.StartCollectingMetrics();
+    if (checking)
+    {
+        checkstamp = System::Timestamp(clock);
+        deadline = checkstamp + duration;
+    }
+    if (intervals)
+        metrics.StartInterval(System::Timestamp());
+    while (!stopped() && (infinite || timed || (operations > 0)))
+    {
+        // Limit the last batch with the remaining operations
+        int64_t count = (infinite || timed || (operations >= batch)) ? batch : operations;
+
+        // Add new metrics operations
+        metrics.AddOperations(count);
+
+        // Store the timestamp for the automatic latency update and samples
+        if (timing)
+            timestamp = System::Timestamp(clock);
+
+        // Run benchmark operations batch...
+        for (int64_t i = 0; i < count; ++i)
+            run();
+
+        if (timing)
+        {
+            uint64_t timespan = System::Timestamp(clock) - timestamp;
+
+            // Update latency metrics with the average latency of the batch operation
+            if (latency_auto)
+                metrics.AddLatency(timespan / count, count);
+
+            // Add operations batch sample
+            if (sampling)
+                metrics.AddSample(timestamp, timespan, count);
+        }
+
+        // Decrement operation counters
+        operations -= count;
+
+        // Check the deadline and interval snapshots every few batches
+        if (checking && (--countdown == 0))
+        {
+            uint64_t checkpoint = System::Timestamp(clock);
+            if (timed && (checkpoint >= deadline))
+                break;
+
+            if (intervals)
+                metrics.UpdateInterval(System::Timestamp());
+
+            // Derive the next check interval from the measured time per batch to check about once per millisecond
+            // and not later than the deadline. The interval grows at most twice per check and shrinks at once
+            // when operations become slower.
+            uint64_t elapsed = checkpoint - checkstamp;
+            uint64_t target = timed ? std::min((uint64_t)1000000, deadline - checkpoint) : 1000000;
+            int64_t next = (elapsed > 0) ? (int64_t)((double)target * interval / elapsed) : (2 * interval);
+            interval = std::clamp(next, (int64_t)1, std::min(2 * interval, limit));
+
+            checkstamp = checkpoint;
+            countdown = interval;
+        }
+    }
+    if (intervals)
+        metrics.StopInterval(System::Timestamp());
+    phase.StopCollectingMetrics();
+}
+
+template <class TRun, class TStopped>
+inline void BenchmarkBase::RunOperationsPaced(PhaseCore& phase, bool infinite, int64_t duration, int64_t operations, TRun run, TStopped stopped)
+{
+    bool sampling = (_settings.samples() > 0);
+    ClockType clock = _clock;
+
+    PhaseMetrics& metrics = phase.current();
+
+    bool timed = (duration > 0);
+    bool intervals = (metrics._interval_period > 0);
+
+    // Sleep while the intended start time is far enough and spin for the rest of the time
+    const uint64_t spin = 100000;
+
+    // Inter-arrival time of operations in nanoseconds
+    const double interval = 1000000000.0 / _settings.rate();
+    std::mt19937_64 generator(System::CurrentThreadId() ^ System::Timestamp());
+    std::exponential_distribution<double> arrival(1.0);
+
+    phase.StartCollectingMetrics();
+    uint64_t start = System::Timestamp(clock);
+    uint64_t deadline = start + duration;
+    double offset = 0.0;
+    if (intervals)
+        metrics.StartInterval(System::Timestamp());
+    while (!stopped() && (infinite || timed || (operations > 0)))
+    {
+        // Calculate the intended start time of the next operation
+        uint64_t intended = start + (uint64_t)offset;
+        offset += _settings.rate_poisson() ? (interval * arrival(generator)) : interval;
+
+        // Stop the timed operations loop at the deadline (also when operations fall behind the intended start times)
+        uint64_t timestamp = System::Timestamp(clock);
+        if (timed && ((intended >= deadline) || (timestamp >= deadline)))
+            break;
+
+        // Wait for the intended start time
+        if ((timestamp + spin) < intended)
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(intended - timestamp - spin));
+            timestamp = System::Timestamp(clock);
+        }
+        while (timestamp < intended)
+            timestamp = System::Timestamp(clock);
+
+        // Add new metrics operation
+        metrics.AddOperations(1);
+
+        // Run benchmark operation...
+        run();
+
+        // Update latency metrics with the latency from the intended start time
+        uint64_t timespan = System::Timestamp(clock) - intended;
+        metrics.AddLatency(timespan);
+
+        // Add operation sample
+        if (sampling)
+            metrics.AddSample(intended, timespan, 1);
+
+        // Update interval snapshots
+        if (intervals)
+            metrics.UpdateInterval(System::Timestamp());
+
+        // Decrement operation counters
+        --operations;
+    }
+    if (intervals)
+        metrics.StopInterval(System::Timestamp());
+    phase.StopCollectingMetrics();
+}
+
+template <class TRun, class TStopped>
+inline int64_t BenchmarkBase::CalibrateBatch(TRun run, TStopped stopped, int64_t operations)
+{
+    ClockType clock = _clock;
+
+    // Measure the timestamp clock resolution
+    uint64_t resolution = std::numeric_limits<uint64_t>::max();
+    for (int i = 0; i < 16; ++i)
+    {
+        uint64_t timestamp1 = System::Timestamp(clock);
+        uint64_t timestamp2;
+        do { timestamp2 = System::Timestamp(clock); } while (timestamp2 == timestamp1);
+        resolution = std::min(resolution, timestamp2 - timestamp1);
+    }
+
+    // Batch duration should be well above the timestamp clock resolution
+    const uint64_t target = 1000 * resolution;
+    const int64_t limit = 1 << 24;
+
+    // Uncounted calibration operations are limited with the fixed count of operations
+    int64_t budget = (operations > 0) ? operations : std::numeric_limits<int64_t>::max();
+
+    // Double the batch size until the batch duration reaches the target one
+    int64_t batch = 1;
+    while ((batch < limit) && (batch <= budget) && !stopped())
+    {
+        uint64_t timestamp = System::Timestamp(clock);
+
+        // Run benchmark operations batch...
+        for (int64_t i = 0; i < batch; ++i)
+            run();
+
+        if ((System::Timestamp(clock) - timestamp) >= target)
+            break;
+
+        budget -= batch;
+        batch *= 2;
+    }
+
+    return (operations > 0) ? std::min(batch, operations) : batch;
+}
+
+template <class TStopped>
+inline void BenchmarkBase::CalibrateOverhead(Context& context, int64_t batch, TStopped stopped)
+{
+    const int passes = 5;
+    const int64_t operations = std::max<int64_t>(64 * batch, 65536);
+
+    int64_t overhead_time = std::numeric_limits<int64_t>::max();
+    int64_t overhead_latency = std::numeric_limits<int64_t>::max();
+
+    // Run empty operations through the benchmark operations loop and choose the best pass
+    PhaseCore calibration("overhead");
+    for (int pass = 0; pass < passes; ++pass)
+    {
+        calibration.InitLatencyHistogram(_settings.latency());
+        if (_settings.samples() > 0)
+            calibration.InitSamples(_settings.samples(), _settings.samples_reservoir());
+
+        RunOperationsLoop(calibration, false, 0, operations, batch, [this, &context]() { EmptyOperation(context); }, stopped);
+
+        const PhaseMetrics& metrics = calibration.current();
+        if (metrics.total_operations() > 0)
+        {
+            overhead_time = std::min(overhead_time, metrics.avg_time());
+            if (_settings.latency_auto() && metrics.latency())
+                overhead_latency = std::min(overhead_latency, (int64_t)metrics.mean_latency());
+        }
+
+        calibration.ResetMetrics();
+    }
+
+    // Update the harness overhead of the current phase
+    if (overhead_time != std::numeric_limits<int64_t>::max())
+        context._metrics->SetOverhead(overhead_time, (overhead_latency != std::numeric_limits<int64_t>::max()) ? overhead_latency : 0);
+}
+
+} // namespace CppBenchmark
@@ -67,10 +67,8 @@ protected:
     virtual void RunConsumer(ContextPC& context) = 0;
 
 private:
-    std::vector<std::thread> _threads;
-
     int CountLaunches() const override;
-    void Launch(int& current, int total, LauncherHandler& handler) override;
+    void Launch(int& current, int& total, ClockType clock, LauncherHandler& handler) override;
 };
 
 /*! \example spsc.cpp Single producer, single consumer benchmark */
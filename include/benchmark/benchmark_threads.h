@@ -58,10 +58,8 @@ protected:
     virtual void RunThread(ContextThreads& context) = 0;
 
 private:
-    std::vector<std::thread> _threads;
-
     int CountLaunches() const override;
-    void Launch(int& current, int total, LauncherHandler& handler) override;
+    void Launch(int& current, int& total, ClockType clock, LauncherHandler& handler) override;
 };
 
 /*! \example threads.cpp Threads integer increment benchmark */
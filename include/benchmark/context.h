@@ -68,6 +68,8 @@ public:
     void StopPhase() override { _current->StopPhase(); }
     std::shared_ptr<PhaseScope> ScopePhase(const std::string& phase) override { return _current->ScopePhase(phase); }
     std::shared_ptr<PhaseScope> ScopePhaseThreadSafe(const std::string& phase) override { return _current->ScopePhaseThreadSafe(phase); }
+    PhaseHandle ResolvePhase(const std::string& phase) override { return _current->ResolvePhase(phase); }
+    PhaseHandle ResolvePhaseThreadSafe(const std::string& phase) override { return _current->ResolvePhaseThreadSafe(phase); }
 
 protected:
     //! Benchmark first parameter. Valid only if not negative!
@@ -0,0 +1,100 @@
+/*!
+    \file counters.h
+    \brief Hardware performance counters definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_COUNTERS_H
+#define CPPBENCHMARK_COUNTERS_H
+
+#include <array>
+#include <cstdint>
+
+namespace CppBenchmark {
+
+//! Performance counter type
+enum class CounterType
+{
+    Cycles,             //!< CPU cycles
+    Instructions,       //!< Retired instructions
+    BranchMisses,       //!< Mispredicted branches
+    L1DMisses,          //!< L1 data cache read misses
+    LLCMisses,          //!< Last level cache misses
+    DTLBMisses,         //!< Data TLB read misses
+    TaskClock,          //!< Task clock in nanoseconds (software event)
+    PageFaults          //!< Page faults (software event)
+};
+
+//! Performance counters group
+/*!
+    Opens performance counters for the current thread. Hardware events are opened as a single group to
+    be scheduled on the PMU together, software events are opened as another group. Events which cannot
+    be opened (no PMU in virtual machines, restrictive perf_event_paranoid, unsupported platform) are
+    skipped, so the group degrades to software events or to no events at all.
+
+    Counters values are read with one system call per group and scaled by the enabled/running time
+    ratio when the PMU multiplexes events. Values of a group which was not scheduled on the PMU at all
+    (zero running time) are not updated.
+
+    Nested phases of the same thread share the group of their parent phase and read its deltas.
+
+    Not thread-safe. Must be read from the thread that created it.
+*/
+class Counters
+{
+public:
+    //! Count of counter types
+    static const int COUNT = 8;
+
+    //! Counters values
+    typedef std::array<int64_t, COUNT> Values;
+
+    //! Open performance counters for the current thread
+    Counters();
+    Counters(const Counters&) = delete;
+    Counters(Counters&&) = delete;
+    ~Counters();
+
+    Counters& operator=(const Counters&) = delete;
+    Counters& operator=(Counters&&) = delete;
+
+    //! Get mask of available counters (bit index is the counter type)
+    uint32_t mask() const noexcept { return _mask; }
+    //! Get Id of the thread which opened counters
+    uint64_t thread() const noexcept { return _thread; }
+
+    //! Read the current values of counters
+    /*!
+        Values of unavailable counters are not changed.
+
+        \param values - Counters values to read into
+    */
+    void Read(Values& values) const noexcept;
+
+    //! Get counter type name
+    /*!
+        \param type - Counter type
+        \return Counter type name
+    */
+    static const char* Name(CounterType type) noexcept;
+
+private:
+    uint32_t _mask;
+    uint64_t _thread;
+    int _hardware;
+    int _software;
+    std::array<int, COUNT> _fds;
+    std::array<CounterType, COUNT> _hardware_types;
+    int _hardware_count;
+    std::array<CounterType, COUNT> _software_types;
+    int _software_count;
+
+    int Open(CounterType type, int group) noexcept;
+    static void ReadGroup(int fd, const std::array<CounterType, COUNT>& types, int count, Values& values) noexcept;
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_COUNTERS_H
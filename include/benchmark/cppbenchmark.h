@@ -9,12 +9,19 @@
 #ifndef CPPBENCHMARK_H
 #define CPPBENCHMARK_H
 
+#include "benchmark/allocations.h"
 #include "benchmark/executor.h"
 #include "benchmark/launcher_console.h"
 #include "benchmark/reporter_console.h"
 #include "benchmark/reporter_csv.h"
 #include "benchmark/reporter_json.h"
 
+#include <new>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
 namespace CppBenchmark {
 
 //! @cond INTERNALS
@@ -27,15 +34,121 @@ public:
     { LauncherConsole::GetInstance().AddBenchmarkBuilder(builder); }
 };
 
+class AllocationsRegistrator
+{
+public:
+    AllocationsRegistrator() noexcept { Allocations::Enable(); }
+};
+
+class BenchmarkHandle
+{
+public:
+    const PhaseHandle& Resolve(std::string_view benchmark, uint64_t hash)
+    {
+        if (!_handle || (_hash != hash))
+        {
+            _handle = Executor::ResolveBenchmark(benchmark, hash);
+            _hash = hash;
+        }
+        return _handle;
+    }
+
+private:
+    uint64_t _hash{0};
+    PhaseHandle _handle;
+};
+
+#if defined(_MSC_VER) && !defined(__clang__)
+inline const volatile void* volatile sink = nullptr;
+#endif
+
 } // namespace Internals
 //! @endcond
 
+//! Prevent the compiler from optimizing away the given value
+/*!
+    Value is treated as used by an opaque code, so the compiler must compute and materialize it. Call is zero-cost
+    and does not add any instructions into the benchmark operation (on GCC/Clang).
+
+    Example:
+    \code{.cpp}
+    BENCHMARK("sin()")
+    {
+        DoNotOptimize(sin(123.456));
+    }
+    \endcode
+
+    \param value - Value to keep alive
+*/
+template <typename T>
+inline void DoNotOptimize(const T& value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    Internals::sink = &value;
+    _ReadWriteBarrier();
+#endif
+}
+
+//! Prevent the compiler from optimizing away the given value and from assuming its content after the call
+/*!
+    \param value - Value to keep alive
+*/
+template <typename T>
+inline void DoNotOptimize(T& value) noexcept
+{
+#if defined(__clang__)
+    asm volatile("" : "+r,m"(value) : : "memory");
+#elif defined(__GNUC__)
+    asm volatile("" : "+m,r"(value) : : "memory");
+#else
+    Internals::sink = &value;
+    _ReadWriteBarrier();
+#endif
+}
+
+//! Force the compiler to flush all pending memory writes
+/*!
+    All writes made before the call are treated as visible to an opaque code, so the compiler cannot eliminate them.
+*/
+inline void ClobberMemory() noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    _ReadWriteBarrier();
+#endif
+}
+
+//! Launder the given pointer
+/*!
+    Returned pointer is treated as produced by an opaque code, so the compiler cannot assume anything about
+    its origin and the pointed memory (e.g. to hoist loads out of the benchmark operation).
+
+    \param pointer - Pointer to launder
+    \return Laundered pointer
+*/
+template <typename T>
+inline T* Launder(T* pointer) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+r"(pointer) : : "memory");
+#else
+    Internals::sink = pointer;
+    _ReadWriteBarrier();
+    pointer = (T*)Internals::sink;
+#endif
+    return pointer;
+}
+
 } // namespace CppBenchmark
 
 //! @cond INTERNALS
 #define BENCHMARK_INTERNAL_UNIQUE_NAME_LINE2(name, line) name##line
 #define BENCHMARK_INTERNAL_UNIQUE_NAME_LINE(name, line) BENCHMARK_INTERNAL_UNIQUE_NAME_LINE2(name, line)
 #define BENCHMARK_INTERNAL_UNIQUE_NAME(name) BENCHMARK_INTERNAL_UNIQUE_NAME_LINE(name, __LINE__)
+#define BENCHCODE_INTERNAL_HANDLE(name) [&]() -> const CppBenchmark::PhaseHandle& { const auto& benchcode_name = name; thread_local CppBenchmark::Internals::BenchmarkHandle handle; return handle.Resolve(benchcode_name, CppBenchmark::Executor::Hash(benchcode_name)); }()
 //! @endcond
 
 //! Benchmark main entry point macro
@@ -52,6 +165,42 @@ int main(int argc, char** argv)\
     return 0;\
 }
 
+//! Benchmark heap allocations tracking macro
+/*!
+    Replaces global operator new/delete to track heap allocations. Place this macro in some .cpp file of the
+    benchmark executable to report allocations count, frees count, allocated bytes and peak live bytes of
+    each benchmark phase (e.g. to make "allocations/op > 0" visible for hot paths). Peak live bytes of the
+    benchmark with several threads is the sum of the threads peaks, which is an upper bound of the real peak.
+
+    Example:
+    \code{.cpp}
+    BENCHMARK_ALLOCATIONS()
+    BENCHMARK_MAIN()
+    \endcode
+*/
+#define BENCHMARK_ALLOCATIONS()\
+namespace CppBenchmark { namespace Internals { AllocationsRegistrator allocations_registrator; } }\
+void* operator new(std::size_t size) { return CppBenchmark::Allocations::New(size); }\
+void* operator new[](std::size_t size) { return CppBenchmark::Allocations::New(size); }\
+void* operator new(std::size_t size, std::align_val_t alignment) { return CppBenchmark::Allocations::New(size, (std::size_t)alignment); }\
+void* operator new[](std::size_t size, std::align_val_t alignment) { return CppBenchmark::Allocations::New(size, (std::size_t)alignment); }\
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return CppBenchmark::Allocations::NewNoThrow(size); }\
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return CppBenchmark::Allocations::NewNoThrow(size); }\
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return CppBenchmark::Allocations::NewNoThrow(size, (std::size_t)alignment); }\
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return CppBenchmark::Allocations::NewNoThrow(size, (std::size_t)alignment); }\
+void operator delete(void* ptr) noexcept { CppBenchmark::Allocations::Deallocate(ptr); }\
+void operator delete[](void* ptr) noexcept { CppBenchmark::Allocations::Deallocate(ptr); }\
+void operator delete(void* ptr, std::size_t) noexcept { CppBenchmark::Allocations::Deallocate(ptr); }\
+void operator delete[](void* ptr, std::size_t) noexcept { CppBenchmark::Allocations::Deallocate(ptr); }\
+void operator delete(void* ptr, std::align_val_t alignment) noexcept { CppBenchmark::Allocations::Deallocate(ptr, (std::size_t)alignment); }\
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept { CppBenchmark::Allocations::Deallocate(ptr, (std::size_t)alignment); }\
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept { CppBenchmark::Allocations::Deallocate(ptr, (std::size_t)alignment); }\
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept { CppBenchmark::Allocations::Deallocate(ptr, (std::size_t)alignment); }\
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { CppBenchmark::Allocations::Deallocate(ptr); }\
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { CppBenchmark::Allocations::Deallocate(ptr); }\
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { CppBenchmark::Allocations::Deallocate(ptr, (std::size_t)alignment); }\
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { CppBenchmark::Allocations::Deallocate(ptr, (std::size_t)alignment); }
+
 //! Benchmark register macro
 /*!
     Register a new benchmark with a given name and settings. Next to the definition you should provide a benchmark code.
@@ -261,7 +410,11 @@ namespace CppBenchmark { Internals::BenchmarkRegistrator BENCHMARK_INTERNAL_UNIQ
 //! Dynamic benchmark scope register macro
 /*!
     Create a scope guard for dynamic benchmark with the given \a name. It will be automatically registered in static
-    Executor class.
+    Executor class. Dynamic benchmark is resolved once per call site and thread, so next calls do not allocate
+    memory or lookup the benchmark by its name.
+
+    Scope guard is a non-copyable CppBenchmark::PhaseHandleScope living on the stack. Code which stored the result
+    as std::shared_ptr<PhaseScope> should use CppBenchmark::Executor::ScopeBenchmark() instead.
 
     Example:
     \code{.cpp}
@@ -274,7 +427,7 @@ namespace CppBenchmark { Internals::BenchmarkRegistrator BENCHMARK_INTERNAL_UNIQ
     }
     \endcode
 */
-#define BENCHCODE_SCOPE(name) CppBenchmark::Executor::ScopeBenchmark(name);
+#define BENCHCODE_SCOPE(name) CppBenchmark::PhaseHandleScope(BENCHCODE_INTERNAL_HANDLE(name));
 
 //! Dynamic benchmark start macro
 /*!
@@ -291,7 +444,7 @@ namespace CppBenchmark { Internals::BenchmarkRegistrator BENCHMARK_INTERNAL_UNIQ
     BENCHCODE_STOP("My dynamic benchmark");
     \endcode
 */
-#define BENCHCODE_START(name) CppBenchmark::Executor::StartBenchmark(name);
+#define BENCHCODE_START(name) BENCHCODE_INTERNAL_HANDLE(name).Start();
 
 //! Dynamic benchmark stop macro
 /*!
@@ -308,7 +461,7 @@ namespace CppBenchmark { Internals::BenchmarkRegistrator BENCHMARK_INTERNAL_UNIQ
     BENCHCODE_STOP("My dynamic benchmark");
     \endcode
 */
-#define BENCHCODE_STOP(name) CppBenchmark::Executor::StopBenchmark(name);
+#define BENCHCODE_STOP(name) BENCHCODE_INTERNAL_HANDLE(name).Stop();
 
 //! Dynamic benchmarks report to console macro
 /*!
@@ -11,19 +11,42 @@
 
 #include "benchmark/phase_core.h"
 #include "benchmark/reporter.h"
+#include "benchmark/sampling.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 namespace CppBenchmark {
 
 //! Dynamic benchmarks executor class
 /*!
     Provides interface to register dynamic benchmarks and report results with external reporters.
+
+    Each thread registers its dynamic benchmarks in its own registry keyed by the benchmark name hash, so
+    starting and stopping dynamic benchmarks takes no global lock and does not depend on the count of
+    registered benchmarks. Names with colliding hashes are registered with the next free keys.
+    Dynamic benchmarks of all threads are aggregated only in Report() method.
+
+    Dynamic benchmarks might measure only sampled calls according to their sampling policy. Unsampled calls are
+    only counted, so the instrumentation might be left in frequently called production code.
+
+    Live metrics of dynamic benchmarks might be exported into the shared memory region to be read by external
+    processes (e.g. cppbenchmark-top tool) without formatting reports in the instrumented process.
+
+    Background reporting thread might periodically report metrics of the last window. Instrumented threads are
+    never paused: each thread moves metrics of its dynamic benchmark into a window snapshot and resets them at
+    the next start of the dynamic benchmark after the new window is requested.
 */
 class Executor
 {
 public:
     Executor(const Executor&) = delete;
     Executor(Executor&&) = delete;
-    ~Executor() = default;
+    ~Executor() { StopReportingThread(); }
 
     Executor& operator=(const Executor&) = delete;
     Executor& operator=(Executor&&) = delete;
@@ -37,7 +60,18 @@ public:
         \param benchmark - Dynamic benchmark name
         \return Shared pointer to the required dynamic benchmark
     */
-    static std::shared_ptr<Phase> StartBenchmark(const std::string& benchmark);
+    static std::shared_ptr<Phase> StartBenchmark(const std::string& benchmark)
+    { return StartBenchmark(benchmark, Hash(benchmark)); }
+    //! Start a new dynamic benchmark with a given name and precomputed name hash
+    /*!
+        Dynamic benchmarks are identified by the name hash, so the hash should be calculated with Hash() method.
+        The name is used only to register a new dynamic benchmark. Please note the method is thread-safe and might be called in multi-thread environment!
+
+        \param benchmark - Dynamic benchmark name
+        \param hash - Dynamic benchmark name hash
+        \return Shared pointer to the required dynamic benchmark
+    */
+    static std::shared_ptr<Phase> StartBenchmark(std::string_view benchmark, uint64_t hash);
 
     //! Stop dynamic benchmark with a given name
     /*!
@@ -46,7 +80,24 @@ public:
 
         \param benchmark - Dynamic benchmark name
     */
-    static void StopBenchmark(const std::string& benchmark);
+    static void StopBenchmark(const std::string& benchmark)
+    { StopBenchmark(benchmark, Hash(benchmark)); }
+    //! Stop dynamic benchmark with a given name and precomputed name hash
+    /*!
+        Please note the method is thread-safe and might be called in multi-thread environment!
+
+        \param benchmark - Dynamic benchmark name
+        \param hash - Dynamic benchmark name hash
+    */
+    static void StopBenchmark(std::string_view benchmark, uint64_t hash);
+    //! Stop dynamic benchmark with a given precomputed name hash
+    /*!
+        If several names have the same hash then the first registered dynamic benchmark is stopped.
+        Please note the method is thread-safe and might be called in multi-thread environment!
+
+        \param hash - Dynamic benchmark name hash
+    */
+    static void StopBenchmark(uint64_t hash);
 
     //! Start a new dynamic benchmark with a given name and wrap it in a PhaseScope
     /*!
@@ -57,26 +108,186 @@ public:
     */
     static std::shared_ptr<PhaseScope> ScopeBenchmark(const std::string& benchmark)
     { return std::make_shared<PhaseScope>(StartBenchmark(benchmark)); }
+    //! Start a new dynamic benchmark with a given name and precomputed name hash and wrap it in a PhaseScope
+    /*!
+        Please note the method is thread-safe and might be called in multi-thread environment!
+
+        \param benchmark - Dynamic benchmark name
+        \param hash - Dynamic benchmark name hash
+        \return Shared pointer to the required dynamic benchmark scope wrapper
+    */
+    static std::shared_ptr<PhaseScope> ScopeBenchmark(std::string_view benchmark, uint64_t hash)
+    { return std::make_shared<PhaseScope>(StartBenchmark(benchmark, hash)); }
+
+    //! Resolve a dynamic benchmark with a given name and precomputed name hash
+    /*!
+        This method will create or get existent dynamic benchmark of the current thread with a given name and return
+        its handle without starting benchmark measurement. The handle can be used to start and stop the dynamic
+        benchmark many times without memory allocations and lookups. Please note the method is thread-safe and might
+        be called in multi-thread environment, but the returned handle should be used only in the current thread!
+
+        \param benchmark - Dynamic benchmark name
+        \param hash - Dynamic benchmark name hash
+        \return Dynamic benchmark handle
+    */
+    static PhaseHandle ResolveBenchmark(std::string_view benchmark, uint64_t hash)
+    { return PhaseHandle(nullptr, FindBenchmark(benchmark, hash).get()); }
+
+    //! Calculate dynamic benchmark name hash
+    /*!
+        FNV-1a 64-bit hash which is calculated at compile time for string literals.
+
+        \param benchmark - Dynamic benchmark name
+        \return Dynamic benchmark name hash
+    */
+    static constexpr uint64_t Hash(std::string_view benchmark) noexcept
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : benchmark)
+            hash = (hash ^ (uint8_t)c) * 1099511628211ull;
+        return hash;
+    }
+
+    //! Set default sampling policy of dynamic benchmarks
+    /*!
+        The policy is applied to dynamic benchmarks registered after the call which have no own sampling policy.
+        Please note the method is thread-safe and might be called in multi-thread environment!
+
+        \param sampling - Sampling policy
+    */
+    static void SetSampling(const Sampling& sampling);
+    //! Set sampling policy of the dynamic benchmark with a given name
+    /*!
+        The policy is applied to dynamic benchmarks with a given name registered after the call, so it should be
+        set before the dynamic benchmark is started. Please note the method is thread-safe and might be called in
+        multi-thread environment!
+
+        \param benchmark - Dynamic benchmark name
+        \param sampling - Sampling policy
+    */
+    static void SetSampling(const std::string& benchmark, const Sampling& sampling);
 
     //! Report benchmarks results using the given reporter
     /*!
+        Metrics of the current thread and finished threads are reported up to the call. Other instrumented
+        threads are never paused: their metrics are reported as published at the first start of each dynamic
+        benchmark after the previous report, and the report requests them to publish metrics for the next one.
+        While background reporting is active metrics are published into windows and are not updated by the report.
         Please note the method is thread-safe and might be called in multi-thread environment!
 
         \param reporter - Reporter interface
     */
     static void Report(Reporter& reporter);
 
+    //! Export live metrics of dynamic benchmarks into the shared memory region
+    /*!
+        Shared memory region is created in the given memory mapped file with a slot for each phase of each
+        dynamic benchmark of each thread. Each measured operation is published into its slot with a handful of
+        relaxed stores. Dynamic benchmarks registered before the call are not exported, so the method should be
+        called before dynamic benchmarks are started. The region is kept till the process exit.
+        Please note the method is thread-safe and might be called in multi-thread environment!
+
+        \param path - Memory mapped file path
+        \param capacity - Count of phase slots in the region (default is 1024)
+        \return 'true' if the region was successfully created, 'false' otherwise
+    */
+    static bool Export(const std::string& path, uint32_t capacity = 1024);
+
+    //! Start background reporting of dynamic benchmarks metrics windows
+    /*!
+        Reporting thread will report metrics of dynamic benchmarks collected during each window using the given
+        reporter and reset them. To report into a file create the reporter with a file stream. Metrics of each
+        window are published by the instrumented thread at the next start of the dynamic benchmark, so windows of
+        different threads are aligned with their operations. Metrics reported by windows are not reported with
+        Report() method. Registries of finished threads are dropped after their last window is reported.
+        Please note the method is thread-safe and might be called in multi-thread environment!
+
+        \param reporter - Reporter interface
+        \param interval - Window interval in milliseconds (must be positive)
+    */
+    static void StartReporting(const std::shared_ptr<Reporter>& reporter, int64_t interval);
+    //! Stop background reporting of dynamic benchmarks metrics windows
+    /*!
+        Reporting thread will report the last window before stop without requesting the next one. Metrics published
+        after the last window are reported with Report() method. Please note the method is thread-safe and might
+        be called in multi-thread environment!
+    */
+    static void StopReporting();
+
 protected:
+    //! Dynamic benchmarks registry of the single thread
+    struct Registry
+    {
+        //! Synchronization mutex (locked by the owner thread only to register a new dynamic benchmark)
+        std::mutex mutex;
+        //! Registered benchmarks collection with their global registration order
+        std::vector<std::pair<uint64_t, std::shared_ptr<PhaseCore>>> benchmarks;
+        //! Registered benchmarks index by the name hash
+        std::unordered_map<uint64_t, std::shared_ptr<PhaseCore>> index;
+        //! Is the owner thread finished?
+        std::atomic<bool> finished{false};
+    };
+
     //! Synchronization mutex
     std::mutex _mutex;
-    //! Registered benchmarks collection
-    std::vector<std::shared_ptr<PhaseCore>> _benchmarks;
+    //! Registries collection of all threads
+    std::vector<std::shared_ptr<Registry>> _registries;
+    //! Aggregated results of dynamic benchmarks of finished threads with their registration order
+    std::vector<std::pair<uint64_t, std::shared_ptr<PhaseCore>>> _retired;
+    //! Dynamic benchmarks registration order
+    std::atomic<uint64_t> _order{0};
+    //! Default sampling policy
+    Sampling _sampling;
+    //! Sampling policies of dynamic benchmarks by the name hash
+    std::unordered_map<uint64_t, Sampling> _samplings;
+
+    //! Shared memory metrics export
+    std::unique_ptr<MetricsExport> _export;
+
+    //! Requested metrics window
+    std::atomic<uint64_t> _window{0};
+    //! Is background reporting of metrics windows active?
+    bool _windows{false};
+    //! Reporting thread start & stop synchronization mutex
+    std::mutex _reporting_control;
+    //! Reporting thread synchronization mutex
+    std::mutex _reporting_mutex;
+    //! Reporting thread condition variable
+    std::condition_variable _reporting_cv;
+    //! Reporting thread stop flag
+    bool _reporting_stop{false};
+    //! Reporting thread
+    std::thread _reporting;
 
 private:
     Executor() = default;
 
+    void ReportBenchmarks(Reporter& reporter, std::vector<std::pair<uint64_t, std::shared_ptr<PhaseCore>>>& registered) const;
     void ReportPhase(Reporter& reporter, const PhaseCore& phase, const std::string& name) const;
 
+    //! Reporting thread loop
+    void Reporting(std::shared_ptr<Reporter> reporter, int64_t interval);
+    //! Report metrics of the last window and request the next one
+    void ReportWindow(Reporter& reporter, bool next);
+    //! Keep results of dynamic benchmarks of the finished thread before its registry is dropped
+    void RetireRegistry(Registry& registry);
+    //! Stop and join the reporting thread
+    void StopReportingThread();
+
+    //! Get dynamic benchmarks registry of the current thread
+    static Registry& GetRegistry()
+    { return *CurrentRegistry(true); }
+    //! Get dynamic benchmarks registry of the current thread (nullptr if it is not created)
+    static Registry* CurrentRegistry(bool create);
+    //! Find or create a dynamic benchmark of the current thread with the given name hash
+    static const std::shared_ptr<PhaseCore>& FindBenchmark(std::string_view benchmark, uint64_t hash);
+    //! Take published metrics snapshot of the dynamic benchmark
+    static std::shared_ptr<PhaseCore> TakeSnapshot(PhaseCore& benchmark);
+    //! Merge published metrics snapshot into results of the dynamic benchmark phase of some thread
+    static void MergeSnapshot(PhaseCore& phase, PhaseCore& snapshot);
+    //! Merge dynamic benchmark phase of some thread into the aggregated one
+    static void MergeBenchmark(PhaseCore& result, PhaseCore& phase);
+
     //! Get singleton instance
     static Executor& GetInstance()
     { static Executor instance; return instance; }
@@ -61,13 +61,16 @@ protected:
     //! Cleanup producer
     /*!
         This method is called to cleanup producer in separate thread.
+        It is called after all producers and consumers are stopped, so consumption
+        should be stopped in run methods rather than here.
 
         \param context - Producer running context
     */
     virtual void CleanupProducer(ContextPC& context) {}
     //! Cleanup consumer
     /*!
-        This method is called to cleanup consumer in separate thread.
+        This method is called to cleanup consumer in separate thread
+        when all producers and consumers are stopped.
 
         \param context - Consumer running context
     */
@@ -15,6 +15,8 @@
 #include "benchmark/launcher_handler.h"
 #include "benchmark/reporter.h"
 
+#include <algorithm>
+
 namespace CppBenchmark {
 
 //! Launcher base class
@@ -24,7 +26,7 @@ namespace CppBenchmark {
 class Launcher : public LauncherHandler
 {
 public:
-    Launcher() = default;
+    Launcher() : _clock(ClockType::Monotonic), _jobs(1), _jobs_spread(false) {}
     Launcher(const Launcher&) = delete;
     Launcher(Launcher&&) = delete;
     virtual ~Launcher() = default;
@@ -48,6 +50,34 @@ public:
     //! Clear benchmark builders collection
     void ClearAllBenchmarksBuilders() { _builders.clear(); }
 
+    //! Get the default timestamp clock
+    ClockType clock() const noexcept { return _clock; }
+    //! Set the default timestamp clock
+    /*!
+        Default timestamp clock will be used for all benchmarks which settings do not provide their own clock.
+
+        \param clock - Timestamp clock
+    */
+    void SetClock(ClockType clock) noexcept { _clock = clock; }
+
+    //! Get the count of parallel jobs
+    int jobs() const noexcept { return _jobs; }
+    //! Are parallel jobs spread across last level caches?
+    bool jobs_spread() const noexcept { return _jobs_spread; }
+    //! Set the count of parallel jobs
+    /*!
+        Single-threaded benchmarks (Benchmark instances) are launched concurrently with the given count of jobs.
+        Each job is bound to its own physical core, so the count of jobs is limited by the count of physical
+        cores. Threads and producers/consumers benchmarks are launched one by one after all parallel jobs.
+
+        Launched benchmarks should be independent from each other. Launching and launched notifications of
+        parallel jobs are serialized and delivered together after each launch is finished.
+
+        \param jobs - Count of parallel jobs (1 to launch all benchmarks one by one)
+        \param spread - Spread parallel jobs across last level caches (default is false)
+    */
+    void SetJobs(int jobs, bool spread = false) noexcept { _jobs = std::max(jobs, 1); _jobs_spread = spread; }
+
     //! Launch registered benchmarks
     /*!
         Launch benchmarks from the benchmarks collection which names are matched to the given string pattern. String
@@ -67,17 +97,32 @@ public:
         \param resolution - Histogram resolution
     */
     void ReportHistograms(int32_t resolution) const;
+    //! Report benchmarks interval snapshots
+    /*!
+        Interval snapshots of each phase will be written as the HdrHistogram interval log (<name>.hlog, if latency
+        is collected) and as JSON lines (<name>.intervals.json).
+    */
+    void ReportIntervals() const;
 
 protected:
     //! Registered benchmarks collection
     std::vector<std::shared_ptr<BenchmarkBase>> _benchmarks;
     //! Benchmark builders collection
     std::vector<std::function<std::shared_ptr<BenchmarkBase>()>> _builders;
+    //! Default timestamp clock
+    ClockType _clock;
+    //! Count of parallel jobs
+    int _jobs;
+    //! Spread parallel jobs across last level caches
+    bool _jobs_spread;
 
 private:
+    ClockType ResolveClock(const Settings& settings) const;
+    void LaunchJobs(const std::vector<std::shared_ptr<BenchmarkBase>>& benchmarks, int& current, int& total);
     void ReportPhase(Reporter& reporter, const PhaseCore& phase, const std::string& name) const;
     void ReportPhaseHistograms(int32_t resolution, const PhaseCore& phase, const std::string& name) const;
     void ReportPhaseHistogram(int32_t resolution, const PhaseCore& phase, const std::string& name) const;
+    void ReportPhaseIntervals(const PhaseCore& phase, const std::string& name) const;
 };
 
 } // namespace CppBenchmark
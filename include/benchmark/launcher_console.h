@@ -60,8 +60,9 @@ private:
     int32_t _histograms;
     std::string _filter;
     std::string _output;
+    std::string _trace;
 
-    LauncherConsole() : _init(false), _list(false), _quiet(false), _histograms(0), _filter(""), _output("console") {}
+    LauncherConsole() : _init(false), _list(false), _quiet(false), _histograms(0), _filter(""), _output("console"), _trace("") {}
 };
 
 } // namespace CppBenchmark
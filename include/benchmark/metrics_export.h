@@ -0,0 +1,229 @@
+/*!
+    \file metrics_export.h
+    \brief Shared memory metrics export definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_METRICS_EXPORT_H
+#define CPPBENCHMARK_METRICS_EXPORT_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace CppBenchmark {
+
+//! Exported phase metrics
+/*!
+    Consistent copy of the exported phase metrics slot.
+*/
+struct ExportMetrics
+{
+    //! Count of latency histogram buckets
+    static const int BUCKETS = 64;
+
+    //! Phase full name
+    std::string name;
+    //! Thread Id
+    uint64_t thread;
+    //! Count of phase calls (including unsampled ones)
+    int64_t calls;
+    //! Count of measured phase operations
+    int64_t operations;
+    //! Total time of measured phase operations
+    int64_t total_time;
+    //! Minimal operation latency
+    int64_t min_latency;
+    //! Maximal operation latency
+    int64_t max_latency;
+    //! Latency histogram (bucket N counts operations with latency in [2^(N-1), 2^N) nanoseconds)
+    int64_t buckets[BUCKETS];
+
+    //! Get latency histogram bucket of the given latency
+    /*!
+        \param latency - Latency in nanoseconds
+        \return Latency histogram bucket
+    */
+    static int Bucket(int64_t latency) noexcept
+    {
+        if (latency <= 0)
+            return 0;
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanReverse64(&index, (uint64_t)latency);
+        return (int)index + 1;
+#else
+        return 64 - __builtin_clzll((uint64_t)latency);
+#endif
+    }
+    //! Get operation latency percentile from the latency histogram
+    /*!
+        \param buckets - Latency histogram buckets
+        \param percentile - Percentile (0.0 - 100.0)
+        \return Upper bound of the percentile bucket in nanoseconds
+    */
+    static int64_t Percentile(const int64_t* buckets, double percentile) noexcept;
+};
+
+//! Exported phase metrics slot
+/*!
+    Fixed layout slot of the shared memory region which is updated by the single owner thread and protected
+    with a sequence lock. The slot sequence is odd while the slot is updated and zero while it is not allocated.
+*/
+struct alignas(64) ExportSlot
+{
+    //! Maximal length of the phase full name
+    static const int NAME = 128;
+
+    //! Sequence lock
+    std::atomic<uint64_t> sequence;
+    //! Thread Id
+    uint64_t thread;
+    //! Phase full name (null terminated)
+    char name[NAME];
+    //! Count of phase calls (including unsampled ones)
+    std::atomic<int64_t> calls;
+    //! Count of measured phase operations
+    std::atomic<int64_t> operations;
+    //! Total time of measured phase operations
+    std::atomic<int64_t> total_time;
+    //! Minimal operation latency
+    std::atomic<int64_t> min_latency;
+    //! Maximal operation latency
+    std::atomic<int64_t> max_latency;
+    //! Latency histogram
+    std::atomic<int64_t> buckets[ExportMetrics::BUCKETS];
+
+    //! Publish the measured phase operation
+    /*!
+        Should be called only by the owner thread.
+
+        \param count - Count of phase calls since the previous publish
+        \param ops - Count of measured operations
+        \param duration - Duration of measured operations in nanoseconds
+    */
+    void Publish(int64_t count, int64_t ops, int64_t duration) noexcept
+    {
+        int64_t latency = (ops > 0) ? (duration / ops) : duration;
+        int bucket = std::min(ExportMetrics::Bucket(latency), ExportMetrics::BUCKETS - 1);
+
+        uint64_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        calls.store(calls.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+        operations.store(operations.load(std::memory_order_relaxed) + ops, std::memory_order_relaxed);
+        total_time.store(total_time.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+        buckets[bucket].store(buckets[bucket].load(std::memory_order_relaxed) + ops, std::memory_order_relaxed);
+        if (latency < min_latency.load(std::memory_order_relaxed))
+            min_latency.store(latency, std::memory_order_relaxed);
+        if (latency > max_latency.load(std::memory_order_relaxed))
+            max_latency.store(latency, std::memory_order_relaxed);
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+};
+
+//! Exported metrics region header
+struct alignas(64) ExportHeader
+{
+    //! Region magic signature
+    char magic[8];
+    //! Region layout version
+    uint32_t version;
+    //! Count of slots in the region
+    uint32_t capacity;
+    //! Count of allocated slots
+    std::atomic<uint32_t> count;
+    //! Exporting process Id
+    uint32_t process;
+};
+
+//! Shared memory metrics export
+/*!
+    Memory mapped file with the fixed layout region: ExportHeader followed by the given count of ExportSlot.
+    Exporting process allocates a slot for each exported phase of each thread and publishes its operations
+    with a handful of relaxed stores. Reader processes open the same file and read consistent copies of slots
+    retrying reads of slots which are updated concurrently.
+
+    Thread-safe.
+*/
+class MetricsExport
+{
+public:
+    //! Region magic signature
+    static constexpr char MAGIC[8] = { 'C', 'P', 'P', 'B', 'E', 'N', 'C', 'H' };
+    //! Region layout version
+    static const uint32_t VERSION = 1;
+
+    MetricsExport() noexcept : _header(nullptr), _size(0), _file(nullptr), _mapping(nullptr) {}
+    MetricsExport(const MetricsExport&) = delete;
+    MetricsExport(MetricsExport&&) = delete;
+    ~MetricsExport() { Close(); }
+
+    MetricsExport& operator=(const MetricsExport&) = delete;
+    MetricsExport& operator=(MetricsExport&&) = delete;
+
+    //! Check if the region is mapped
+    explicit operator bool() const noexcept { return _header != nullptr; }
+
+    //! Get count of slots in the region
+    uint32_t capacity() const noexcept { return _header ? _header->capacity : 0; }
+    //! Get count of allocated slots
+    uint32_t count() const noexcept { return _header ? std::min(_header->count.load(std::memory_order_acquire), _header->capacity) : 0; }
+    //! Get exporting process Id
+    uint32_t process() const noexcept { return _header ? _header->process : 0; }
+
+    //! Create a new region in the given file
+    /*!
+        \param path - Region file path
+        \param capacity - Count of slots in the region
+        \return 'true' if the region was successfully created, 'false' otherwise
+    */
+    bool Create(const std::string& path, uint32_t capacity);
+    //! Open the existing region in the given file for reading
+    /*!
+        \param path - Region file path
+        \return 'true' if the region was successfully opened, 'false' otherwise
+    */
+    bool Open(const std::string& path);
+    //! Unmap the region and close its file
+    void Close() noexcept;
+
+    //! Allocate a new slot for the phase of the current thread
+    /*!
+        \param name - Phase full name (truncated to ExportSlot::NAME - 1 characters)
+        \param thread - Thread Id
+        \return Allocated slot or nullptr if the region is full
+    */
+    ExportSlot* Allocate(const std::string& name, uint64_t thread) noexcept;
+
+    //! Read a consistent copy of the slot with the given index
+    /*!
+        \param index - Slot index
+        \param metrics - Exported phase metrics
+        \return 'true' if the slot is allocated, 'false' otherwise
+    */
+    bool Read(uint32_t index, ExportMetrics& metrics) const;
+
+private:
+    ExportHeader* _header;
+    size_t _size;
+    void* _file;
+    void* _mapping;
+
+    ExportSlot* slots() const noexcept { return (ExportSlot*)(_header + 1); }
+
+    bool Map(const std::string& path, uint32_t capacity, bool create);
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_METRICS_EXPORT_H
@@ -9,6 +9,7 @@
 #ifndef CPPBENCHMARK_PHASE_H
 #define CPPBENCHMARK_PHASE_H
 
+#include "benchmark/phase_handle.h"
 #include "benchmark/phase_metrics.h"
 
 #include <memory>
@@ -19,8 +20,8 @@ class PhaseScope;
 
 //! Benchmark phase base class
 /*!
-    Provides interface to start a new sub-phase, stop the current phase, create PhaseScope and access to the current
-    phase name and metrics.
+    Provides interface to start a new sub-phase, stop the current phase, create PhaseScope, resolve PhaseHandle
+    and access to the current phase name and metrics.
 */
 class Phase
 {
@@ -79,6 +80,29 @@ public:
         \return Shared pointer to the required thread-safe benchmark sub-phase scope wrapper
     */
     virtual std::shared_ptr<PhaseScope> ScopePhaseThreadSafe(const std::string& phase) = 0;
+
+    //! Resolve a sub-phase with a given name in a single-thread environment
+    /*!
+        This method will create or get existent sub-phase with a given name and return its handle without starting
+        benchmark measurement. The handle can be used to start and stop the sub-phase many times without memory
+        allocations and name lookups. Please note the method is not thread-safe and should not be called in
+        multi-thread environment!
+
+        \param phase - Sub-phase name
+        \return Sub-phase handle
+    */
+    virtual PhaseHandle ResolvePhase(const std::string& phase) = 0;
+
+    //! Resolve a sub-phase with a given name in a multi-thread environment
+    /*!
+        This method will create or get existent sub-phase of the current thread with a given name and return its
+        handle without starting benchmark measurement. Please note the method is thread-safe and might be called
+        in multi-thread environment, but the returned handle should be used only in the current thread!
+
+        \param phase - Sub-phase name
+        \return Sub-phase handle
+    */
+    virtual PhaseHandle ResolvePhaseThreadSafe(const std::string& phase) = 0;
 };
 
 } // namespace CppBenchmark
@@ -9,10 +9,14 @@
 #ifndef CPPBENCHMARK_PHASE_CORE_H
 #define CPPBENCHMARK_PHASE_CORE_H
 
+#include "benchmark/metrics_export.h"
 #include "benchmark/phase_metrics.h"
 #include "benchmark/phase_scope.h"
+#include "benchmark/sampling.h"
 #include "benchmark/system.h"
+#include "benchmark/trace.h"
 
+#include <atomic>
 #include <limits>
 #include <mutex>
 #include <vector>
@@ -31,13 +35,19 @@ class PhaseCore : public Phase
     friend class BenchmarkThreads;
     friend class Executor;
     friend class Launcher;
+    friend class PhaseHandle;
 
 public:
     //! Create a new benchmark phase core with a given name
     /*!
         \param name - Benchmark phase name
     */
-    explicit PhaseCore(const std::string& name) : _name(name), _thread(System::CurrentThreadId())
+    explicit PhaseCore(const std::string& name)
+        : _name(name), _thread(System::CurrentThreadId()),
+          _sampling_enabled(false), _sampling_skip(false), _sampling_stride(1), _sampling_countdown(1),
+          _sampling_random(0), _sampling_timestamp(0), _window(nullptr), _window_published(0),
+          _export(nullptr), _export_slot(nullptr), _export_calls(0),
+          _trace_name(-1)
     { _metrics_result._total_time = std::numeric_limits<int64_t>::max(); }
     PhaseCore(const PhaseCore&) = delete;
     PhaseCore(PhaseCore&&) = delete;
@@ -54,11 +64,15 @@ public:
     const PhaseMetrics& metrics() const noexcept override { return _metrics_result; }
     std::shared_ptr<Phase> StartPhase(const std::string& phase) override;
     std::shared_ptr<Phase> StartPhaseThreadSafe(const std::string& phase) override;
-    void StopPhase() override { StopCollectingMetrics(); }
+    void StopPhase() override { StopOperation(); }
     std::shared_ptr<PhaseScope> ScopePhase(const std::string& phase) override
     { return std::make_shared<PhaseScope>(StartPhase(phase)); }
     std::shared_ptr<PhaseScope> ScopePhaseThreadSafe(const std::string& phase) override
     { return std::make_shared<PhaseScope>(StartPhaseThreadSafe(phase)); }
+    PhaseHandle ResolvePhase(const std::string& phase) override
+    { return PhaseHandle(this, FindPhase(phase).get()); }
+    PhaseHandle ResolvePhaseThreadSafe(const std::string& phase) override
+    { return PhaseHandle(this, FindPhaseThreadSafe(phase).get()); }
 
 protected:
     //! Synchronization mutex
@@ -74,26 +88,187 @@ protected:
     //! Result phase metrics
     PhaseMetrics _metrics_result;
 
+    //! Sampling policy of the phase operations
+    Sampling _sampling;
+    //! Is sampling of the phase operations enabled (own policy or sampled parent phase)?
+    bool _sampling_enabled;
+    //! Is the current phase operation skipped by sampling?
+    bool _sampling_skip;
+    //! Count of calls between the previous and the next sampled calls
+    int64_t _sampling_stride;
+    //! Count of calls till the next sampled call
+    int64_t _sampling_countdown;
+    //! Sampling random generator state
+    uint64_t _sampling_random;
+    //! Timestamp of the previous sampled call
+    int64_t _sampling_timestamp;
+
+    //! Requested metrics window (nullptr if metrics windows are not used)
+    const std::atomic<uint64_t>* _window;
+    //! Last published metrics window
+    uint64_t _window_published;
+    //! Published metrics window snapshot (protected by the synchronization mutex)
+    std::shared_ptr<PhaseCore> _window_snapshot;
+
+    //! Shared memory metrics export (nullptr if the phase is not exported)
+    MetricsExport* _export;
+    //! Exported phase metrics slot
+    ExportSlot* _export_slot;
+    //! Count of phase calls at the previous export
+    int64_t _export_calls;
+
+    //! Registered trace phase name (-1 if not registered yet)
+    int64_t _trace_name;
+
+    //! Find or create a sub phase with the given name
+    /*!
+        \param phase - Sub-phase name
+        \return Shared pointer to the sub-phase
+    */
+    std::shared_ptr<PhaseCore> FindPhase(const std::string& phase);
+    //! Find or create a sub phase of the current thread with the given name under lock guard
+    /*!
+        \param phase - Sub-phase name
+        \return Shared pointer to the sub-phase
+    */
+    std::shared_ptr<PhaseCore> FindPhaseThreadSafe(const std::string& phase);
+
     //! Initialize latency histogram for the current phase
     /*!
         \param latency - Latency histogram parameters
+        \param attempts - Keep latency histogram of the current attempt (default is false)
     */
-    void InitLatencyHistogram(const std::tuple<int64_t, int64_t, int>& latency) noexcept
-    { _metrics_current.InitLatencyHistogram(latency); }
+    void InitLatencyHistogram(const std::tuple<int64_t, int64_t, int>& latency, bool attempts = false) noexcept
+    { _metrics_current.InitLatencyHistogram(latency, attempts); }
+    //! Initialize samples buffer for the current phase
+    /*!
+        \param capacity - Samples buffer capacity
+        \param reservoir - Reservoir sampling flag
+    */
+    void InitSamples(int64_t capacity, bool reservoir)
+    { _metrics_current.InitSamples(capacity, reservoir); }
+    //! Initialize interval snapshots for the current phase
+    /*!
+        \param period - Period of interval snapshots in nanoseconds
+        \param capacity - Count of retained interval snapshots
+    */
+    void InitIntervals(int64_t period, int64_t capacity)
+    { _metrics_current.InitIntervals(period, capacity); }
+    //! Initialize performance counters for the current phase
+    void InitCounters()
+    { _metrics_current.InitCounters(); }
+    //! Initialize performance counters for the current phase with the counters group of the parent phase
+    /*!
+        Counters group is shared if it was opened by the current thread, otherwise a new one is opened.
+
+        \param parent - Parent phase
+    */
+    void InitCounters(const PhaseCore& parent);
+
+    //! Initialize resources usage collection for the current phase
+    void InitResources() noexcept
+    { _metrics_current.InitResources(); }
+
     //! Print result latency histogram
     /*!
         \param file - File to print into
         \param resolution - Histogram resolution
+        \param attempt - Attempt index (default is -1 for the histogram of all attempts)
+    */
+    void PrintLatencyHistogram(FILE* file, int32_t resolution, int attempt = -1) const noexcept
+    { _metrics_result.PrintLatencyHistogram(file, resolution, attempt); }
+
+    //! Set sampling policy of the phase operations
+    /*!
+        The first call after the policy is set is always sampled.
+
+        \param sampling - Sampling policy
+    */
+    void SetSampling(const Sampling& sampling) noexcept;
+
+    //! Start a new operation of the phase with sampling
+    /*!
+        Unsampled operations are only counted. Child phases are sampled together with operations of
+        their sampled parent phase.
+
+        \param parent - Parent phase (nullptr for the root phase)
+        \return 'true' if the operation is sampled and should be measured, 'false' otherwise
     */
-    void PrintLatencyHistogram(FILE* file, int32_t resolution) const noexcept
-    { _metrics_result.PrintLatencyHistogram(file, resolution); }
+    bool SampleOperation(const PhaseCore* parent) noexcept
+    {
+        if ((parent != nullptr) && parent->_sampling_enabled)
+        {
+            _sampling_enabled = true;
+            _sampling_skip = parent->_sampling_skip;
+        }
+        else if (_sampling.type() != SamplingType::None)
+        {
+            _sampling_skip = (--_sampling_countdown > 0);
+            if (!_sampling_skip)
+                UpdateSampling();
+        }
+        else
+            return true;
+
+        ++_metrics_current._sampling_calls;
+        return !_sampling_skip;
+    }
+    //! Calculate the countdown till the next sampled call
+    void UpdateSampling() noexcept;
+    //! Stop the current operation of the phase if it was sampled
+    void StopOperation() noexcept
+    {
+        if (_sampling_skip)
+            return;
+        if (_export_slot != nullptr)
+            ExportOperation();
+        else
+            StopCollectingMetrics();
+    }
+    //! Stop the current operation of the phase and publish it into the exported phase metrics slot
+    void ExportOperation() noexcept;
+
+    //! Export the phase metrics into the given shared memory region
+    /*!
+        Child phases created after the call are exported with full names.
+
+        \param metrics - Shared memory metrics export
+        \param name - Phase full name
+    */
+    void SetExport(MetricsExport* metrics, const std::string& name) noexcept;
+
+    //! Publish metrics of the current window if the next window is requested
+    /*!
+        Should be called by the owner thread between phase operations.
+    */
+    void UpdateWindow()
+    { if ((_window != nullptr) && (_window->load(std::memory_order_acquire) != _window_published)) PublishWindow(); }
+    //! Publish metrics of the current window as the window snapshot and reset them
+    /*!
+        If the previous window snapshot is not taken yet, then current metrics are kept for the next window.
+    */
+    void PublishWindow();
+    //! Move current metrics of the phase and its child phases into a new snapshot phase
+    std::shared_ptr<PhaseCore> SnapshotMetrics();
 
     //! Start collecting metrics in the current phase
     void StartCollectingMetrics() noexcept
-    { _metrics_current.StartCollecting(); }
+    {
+        if (Trace::enabled())
+            TraceBegin();
+        _metrics_current.StartCollecting();
+    }
     //! Stop collecting metrics in the current phase
     void StopCollectingMetrics() noexcept
-    { _metrics_current.StopCollecting(); }
+    {
+        _metrics_current.StopCollecting();
+        if (Trace::enabled())
+            TraceEnd();
+    }
+    //! Record the phase begin trace event
+    void TraceBegin() noexcept;
+    //! Record the phase end trace event
+    void TraceEnd() noexcept;
 
     //! Merge phase metrics (current to result)
     void MergeMetrics()
@@ -101,6 +276,13 @@ protected:
     //! Merge metrics of the two phases
     void MergeMetrics(PhaseCore& phase)
     { _metrics_result.MergeMetrics(phase._metrics_result); }
+    //! Update result phase statistics over attempts
+    /*!
+        \param selection - Attempt selection policy
+        \param outliers - Outliers rejection threshold (0 to disable rejection)
+    */
+    void UpdateStatistics(AttemptSelection selection, double outliers)
+    { _metrics_result.UpdateStatistics(selection, outliers); }
     //! Reset current phase metrics
     void ResetMetrics() noexcept
     { _metrics_current.ResetMetrics(); }
@@ -0,0 +1,127 @@
+/*!
+    \file phase_handle.h
+    \brief Benchmark phase handle definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_PHASE_HANDLE_H
+#define CPPBENCHMARK_PHASE_HANDLE_H
+
+#include "benchmark/phase_metrics.h"
+
+#include <string>
+
+namespace CppBenchmark {
+
+class Phase;
+class PhaseCore;
+class PhaseHandleScope;
+
+//! Benchmark phase handle
+/*!
+    Lightweight reference to the benchmark sub-phase which is resolved once by its name. Starting and stopping
+    the phase with the handle does not allocate memory, lookup the phase by its name or update reference counters,
+    so it can be used for nested phases in tight loops.
+
+    The handle is valid while its benchmark or dynamic benchmark is alive and should be used in the same thread
+    which resolved it.
+
+    Not thread-safe.
+*/
+class PhaseHandle
+{
+    friend class PhaseHandleScope;
+
+public:
+    //! Create an empty benchmark phase handle
+    PhaseHandle() noexcept : _parent(nullptr), _phase(nullptr) {}
+    //! Create benchmark phase handle of the given phase
+    /*!
+        \param parent - Parent benchmark phase (nullptr for the root phase)
+        \param phase - Benchmark phase
+    */
+    PhaseHandle(PhaseCore* parent, PhaseCore* phase) noexcept : _parent(parent), _phase(phase) {}
+    PhaseHandle(const PhaseHandle&) noexcept = default;
+    PhaseHandle(PhaseHandle&&) noexcept = default;
+    ~PhaseHandle() = default;
+
+    PhaseHandle& operator=(const PhaseHandle&) noexcept = default;
+    PhaseHandle& operator=(PhaseHandle&&) noexcept = default;
+
+    //! Is phase handle valid?
+    explicit operator bool() const noexcept
+    { return (_phase != nullptr); }
+
+    //! Get phase name
+    const std::string& name() const noexcept;
+    //! Get phase metrics
+    const PhaseMetrics& metrics() const noexcept;
+
+    //! Resolve a sub-phase with a given name
+    /*!
+        This method will create or get existent sub-phase with a given name and return its handle.
+
+        \param phase - Sub-phase name
+        \return Sub-phase handle
+    */
+    PhaseHandle ResolvePhase(const std::string& phase) const;
+
+    //! Start a new operation of the phase
+    void Start() const;
+    //! Stop the current operation of the phase
+    void Stop() const noexcept;
+
+    //! Start a new operation of the phase and wrap it in a PhaseHandleScope
+    /*!
+        \return Phase handle scope which stops the operation on destructing
+    */
+    PhaseHandleScope Scope() const;
+
+private:
+    PhaseCore* _parent;
+    PhaseCore* _phase;
+};
+
+//! Benchmark phase handle scope
+/*!
+    Implements scope guard pattern for benchmark phase handle which starts the phase operation on constructing and
+    stops it on destructing. The scope is intended to live on the stack.
+
+    Not thread-safe.
+*/
+class PhaseHandleScope
+{
+public:
+    //! Create benchmark phase handle scope and start a new operation of the phase
+    /*!
+        \param handle - Benchmark phase handle
+    */
+    explicit PhaseHandleScope(const PhaseHandle& handle) : _handle(handle)
+    { _handle.Start(); }
+    PhaseHandleScope(const PhaseHandleScope&) = delete;
+    PhaseHandleScope(PhaseHandleScope&&) = delete;
+    //! Benchmark phase operation will be stopped on destructing
+    ~PhaseHandleScope()
+    { _handle.Stop(); }
+
+    PhaseHandleScope& operator=(const PhaseHandleScope&) = delete;
+    PhaseHandleScope& operator=(PhaseHandleScope&&) = delete;
+
+    //! Get benchmark phase handle
+    const PhaseHandle& handle() const noexcept { return _handle; }
+
+    //! Get benchmark phase to manage its child phases
+    Phase* operator->() const noexcept;
+
+private:
+    PhaseHandle _handle;
+};
+
+inline PhaseHandleScope PhaseHandle::Scope() const
+{ return PhaseHandleScope(*this); }
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_PHASE_HANDLE_H
@@ -9,13 +9,135 @@
 #ifndef CPPBENCHMARK_PHASE_METRICS_H
 #define CPPBENCHMARK_PHASE_METRICS_H
 
+#include "benchmark/allocations.h"
+#include "benchmark/counters.h"
+#include "benchmark/statistics.h"
+#include "benchmark/system.h"
+
 #include <cstdint>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace CppBenchmark {
 
+//! Benchmark phase sample
+/*!
+    Sample of the single operation or the operations batch of the phase execution.
+*/
+struct PhaseSample
+{
+    //! Timestamp of the sample start (in nanoseconds)
+    uint64_t timestamp;
+    //! Duration of the sample (in nanoseconds)
+    uint64_t duration;
+    //! Count of operations in the sample
+    int64_t operations;
+    //! Thread Id of the sample
+    uint64_t thread;
+};
+
+//! Benchmark phase interval snapshot
+/*!
+    Operations, items, bytes and latency of the phase collected in one period of interval snapshots.
+*/
+struct PhaseInterval
+{
+    //! Start timestamp of the interval (nanoseconds)
+    uint64_t timestamp;
+    //! Duration of the interval (nanoseconds)
+    uint64_t duration;
+    //! Operations made in the interval
+    int64_t operations;
+    //! Items processed in the interval
+    int64_t items;
+    //! Bytes processed in the interval
+    int64_t bytes;
+    //! Latency histogram of the interval (HdrHistogram handle, empty if latency is not collected)
+    std::shared_ptr<void> histogram;
+
+    //! Get operations throughput of the interval (operations / second)
+    double operations_per_second() const noexcept
+    { return (duration > 0) ? ((double)operations * 1000000000.0 / duration) : 0.0; }
+    //! Get items throughput of the interval (items / second)
+    double items_per_second() const noexcept
+    { return (duration > 0) ? ((double)items * 1000000000.0 / duration) : 0.0; }
+    //! Get bytes throughput of the interval (bytes / second)
+    double bytes_per_second() const noexcept
+    { return (duration > 0) ? ((double)bytes * 1000000000.0 / duration) : 0.0; }
+};
+
+//! Benchmark phase attempt
+/*!
+    Result of the single independent attempt of the phase execution.
+*/
+struct PhaseAttempt
+{
+    //! Total time of the attempt
+    int64_t total_time;
+    //! Total operations made in the attempt
+    int64_t total_operations;
+    //! Total items processed in the attempt
+    int64_t total_items;
+    //! Total bytes processed in the attempt
+    int64_t total_bytes;
+    //! Is the attempt rejected as an outlier?
+    bool rejected;
+
+    //! Get operations throughput of the attempt (operations / second)
+    double operations_per_second() const noexcept
+    { return (total_time > 0) ? ((double)total_operations * 1000000000.0 / total_time) : 0.0; }
+};
+
+//! Benchmark phase statistics
+/*!
+    Statistics of the operations throughput (operations / second) over all accepted attempts of the phase execution.
+*/
+struct PhaseStatistics
+{
+    //! Count of accepted attempts
+    int attempts;
+    //! Count of rejected outlier attempts
+    int rejected;
+    //! Median throughput
+    double median;
+    //! Mean throughput
+    double mean;
+    //! Median absolute deviation of throughput
+    double mad;
+    //! Coefficient of variation of throughput
+    double cv;
+    //! Lower bound of the throughput mean 95% bootstrap confidence interval
+    double ci_lower;
+    //! Upper bound of the throughput mean 95% bootstrap confidence interval
+    double ci_upper;
+};
+
+//! Benchmark threads fairness
+/*!
+    Imbalance of the operations throughput (operations / second) between benchmark threads of the same role.
+    Values are estimated for threads of the same launch and averaged over all launches.
+*/
+struct PhaseFairness
+{
+    //! Role of benchmark threads ("thread", "producer" or "consumer")
+    std::string role;
+    //! Count of benchmark threads
+    int threads;
+    //! Minimal thread throughput
+    double min;
+    //! Maximal thread throughput
+    double max;
+    //! Mean thread throughput
+    double mean;
+    //! Standard deviation of thread throughput
+    double stdv;
+    //! Jain's fairness index of thread throughput (1 if all threads did the same work)
+    double jain;
+};
+
 //! Benchmark phase metrics
 /*!
     Provides interface of the phase metrics to collect benchmark running statistics:
@@ -26,6 +148,15 @@ namespace CppBenchmark {
     - Total operations made in the phase
     - Total items processed in the phase
     - Total bytes processed in the phase
+    - Harness overhead of the phase operation (if calibrated)
+    - Samples of the phase operations (if collected)
+    - Interval snapshots of the phase operations (if collected)
+    - Attempts of the phase execution and throughput statistics over them
+    - Hardware performance counters of the phase execution (if collected)
+    - Operating system resources usage of the phase execution (if collected)
+    - Heap allocations of the phase execution (if tracked)
+    - Sampling rate of the phase operations (if sampled)
+    - Fairness of benchmark threads (root phases of threads and producers/consumers benchmarks)
 
     If the phase metrics is accessed from benchmark running Context you can update some metrics values:
     - increase operations count with AddOperations() method
@@ -35,6 +166,7 @@ namespace CppBenchmark {
 */
 class PhaseMetrics
 {
+    friend class BenchmarkBase;
     friend class PhaseCore;
 
 public:
@@ -57,6 +189,10 @@ public:
     double mean_latency() const noexcept;
     //! Get latency standard deviation of the phase execution
     double stdv_latency() const noexcept;
+    //! Get latency value at the given percentile (0.0 - 100.0) of the phase execution
+    int64_t percentile_latency(double percentile) const noexcept;
+    //! Get count of kept latency histograms of each attempt
+    size_t latency_attempts() const noexcept { return _attempt_histograms.size(); }
 
     //! Get average time of the phase execution
     int64_t avg_time() const noexcept;
@@ -65,6 +201,26 @@ public:
     //! Get maximal time of the phase execution
     int64_t max_time() const noexcept;
 
+    //! Is metrics contains harness overhead values?
+    bool overhead() const noexcept { return _overhead; }
+    //! Get harness overhead time of the phase operation
+    int64_t overhead_time() const noexcept { return _overhead_time; }
+    //! Get harness overhead latency of the phase operation
+    int64_t overhead_latency() const noexcept { return _overhead_latency; }
+
+    //! Get average time of the phase execution corrected by the harness overhead
+    int64_t avg_time_corrected() const noexcept;
+    //! Get minimal time of the phase execution corrected by the harness overhead
+    int64_t min_time_corrected() const noexcept;
+    //! Get maximal time of the phase execution corrected by the harness overhead
+    int64_t max_time_corrected() const noexcept;
+    //! Get latency minimal value of the phase execution corrected by the harness overhead
+    int64_t min_latency_corrected() const noexcept;
+    //! Get latency maximal value of the phase execution corrected by the harness overhead
+    int64_t max_latency_corrected() const noexcept;
+    //! Get latency mean value of the phase execution corrected by the harness overhead
+    double mean_latency_corrected() const noexcept;
+
     //! Get total time of the phase execution
     int64_t total_time() const noexcept { return _total_time; }
     //! Get total operations made in the phase
@@ -96,7 +252,85 @@ public:
     //! Get custom strings map
     const std::map<std::string, std::string>& custom_str() const noexcept { return _custom_str; }
 
+    //! Get collected samples of the phase execution
+    const std::vector<PhaseSample>& samples() const noexcept { return _samples; }
+    //! Get total count of samples offered to the phase (including overwritten or skipped ones)
+    int64_t total_samples() const noexcept { return _total_samples; }
+
+    //! Get interval snapshots of the phase execution
+    const std::vector<PhaseInterval>& intervals() const noexcept { return _intervals; }
+
+    //! Get attempts of the phase execution
+    const std::vector<PhaseAttempt>& attempts() const noexcept { return _attempts; }
+    //! Get throughput statistics over attempts of the phase execution
+    const PhaseStatistics& statistics() const noexcept { return _statistics; }
+
+    //! Get fairness of benchmark threads for each threads role
+    const std::vector<PhaseFairness>& fairness() const noexcept { return _fairness; }
+
+    //! Is metrics contains performance counters values?
+    bool counters() const noexcept { return (_counters_mask != 0); }
+    //! Is the given performance counter available?
+    bool counter_available(CounterType type) const noexcept { return ((_counters_mask & (1u << (int)type)) != 0); }
+    //! Get total value of the given performance counter of the phase execution
+    int64_t counter(CounterType type) const noexcept { return _counters[(int)type]; }
+    //! Get value of the given performance counter per operation of the phase execution
+    double counter_per_operation(CounterType type) const noexcept
+    { return (_total_operations > 0) ? ((double)_counters[(int)type] / _total_operations) : 0.0; }
+    //! Get instructions per cycle of the phase execution
+    double ipc() const noexcept;
+
+    //! Is metrics contains resources usage values?
+    bool resources() const noexcept { return _resources; }
+    //! Get resources usage of the phase execution
+    const ResourceUsage& resource_usage() const noexcept { return _resource_usage; }
+    //! Get CPU utilization of the phase execution (CPU time / total time)
+    double cpu_utilization() const noexcept
+    { return (_resources && (_total_time > 0)) ? ((double)_resource_usage.cpu_time / _total_time) : 0.0; }
+
+    //! Is metrics contains heap allocations values?
+    bool allocations() const noexcept { return _allocations; }
+    //! Get heap allocations counters of the phase execution
+    /*!
+        Live bytes is the difference of live bytes between the phase stop and start. Peak is the maximal
+        growth of live bytes during the phase execution. Live bytes could be negative if the phase frees
+        memory blocks allocated by another thread.
+    */
+    const AllocationCounters& allocation_counters() const noexcept { return _allocation_counters; }
+    //! Get heap allocations count per operation of the phase execution
+    double allocations_per_operation() const noexcept
+    { return (_total_operations > 0) ? ((double)_allocation_counters.allocations / _total_operations) : 0.0; }
+    //! Get allocated bytes per operation of the phase execution
+    double allocated_bytes_per_operation() const noexcept
+    { return (_total_operations > 0) ? ((double)_allocation_counters.bytes / _total_operations) : 0.0; }
+
+    //! Is metrics collected from sampled operations?
+    bool sampling() const noexcept { return (_sampling_calls > 0); }
+    //! Get count of all calls of the sampled phase (estimated total operations)
+    int64_t sampling_calls() const noexcept { return _sampling_calls; }
+    //! Get effective sampling rate of the phase operations (sampled operations / all calls)
+    double sampling_rate() const noexcept
+    { return (_sampling_calls > 0) ? ((double)_total_operations / _sampling_calls) : 1.0; }
+
     int threads() const noexcept { return _threads; }
+    //! Get logical CPU the phase thread was bound to (-1 if the thread was not bound)
+    int cpu() const noexcept { return _cpu; }
+
+    //! Get timestamp when the phase thread passed the start barrier (0 if not available)
+    int64_t running_start() const noexcept { return _running_start; }
+    //! Get timestamp when the phase thread finished its operations (0 if not available)
+    int64_t running_stop() const noexcept { return _running_stop; }
+
+    //! Is metrics contains start skew and overlap window of benchmark threads?
+    bool overlap() const noexcept { return _overlap; }
+    //! Get start skew of benchmark threads (difference between the last and the first thread start)
+    int64_t start_skew() const noexcept { return _start_skew; }
+    //! Get overlap window of benchmark threads (time when all threads were running)
+    int64_t overlap_time() const noexcept { return _overlap_time; }
+    //! Get estimated operations count of all benchmark threads in the overlap window (-1 if not calculated)
+    int64_t overlap_operations() const noexcept { return _overlap_operations; }
+    //! Get operations throughput in the overlap window (operations / second)
+    int64_t overlap_operations_per_second() const noexcept;
 
     //! Increase operations count of the current phase
     /*!
@@ -173,21 +407,66 @@ public:
     */
     void SetThreads(int threads)
     { _threads = threads; }
+    //! Set logical CPU the phase thread was bound to
+    /*!
+        \param cpu - Logical CPU index (-1 if the thread was not bound)
+    */
+    void SetCpu(int cpu)
+    { _cpu = cpu; }
+    //! Set running timestamps of the phase thread
+    /*!
+        \param start - Timestamp when the thread passed the start barrier
+        \param stop - Timestamp when the thread finished its operations
+    */
+    void SetRunning(int64_t start, int64_t stop) noexcept
+    { _running_start = start; _running_stop = stop; }
+    //! Set start skew and overlap window of benchmark threads
+    /*!
+        \param skew - Start skew
+        \param time - Overlap window time
+        \param operations - Estimated operations count in the overlap window (-1 if not calculated)
+    */
+    void SetOverlap(int64_t skew, int64_t time, int64_t operations) noexcept
+    { _overlap = true; _start_skew = skew; _overlap_time = time; _overlap_operations = operations; }
 
     //! Add latency value of the current phase
     /*!
         \param latency - Latency value
+        \param count - Count of operations with the given latency value (default is 1)
     */
-    void AddLatency(int64_t latency) noexcept;
+    void AddLatency(int64_t latency, int64_t count = 1) noexcept;
+
+    //! Add sample of the current phase
+    /*!
+        Samples are stored into the preallocated buffer. If the buffer is full the oldest sample will be
+        overwritten or the random one will be replaced in the reservoir sampling mode.
+
+        \param timestamp - Timestamp of the sample start
+        \param duration - Duration of the sample
+        \param operations - Count of operations in the sample (default is 1)
+    */
+    void AddSample(uint64_t timestamp, uint64_t duration, int64_t operations = 1) noexcept;
+
+    //! Set harness overhead of the phase operation
+    /*!
+        \param time - Harness overhead time of the phase operation
+        \param latency - Harness overhead latency of the phase operation
+    */
+    void SetOverhead(int64_t time, int64_t latency) noexcept
+    { _overhead = true; _overhead_time = time; _overhead_latency = latency; }
 
 private:
     void* _histogram;
+    std::tuple<int64_t, int64_t, int> _latency_params;
+    bool _latency_attempts;
+    std::vector<void*> _attempt_histograms;
     int64_t _min_time;
     int64_t _max_time;
     int64_t _total_time;
     int64_t _total_operations;
     int64_t _total_items;
     int64_t _total_bytes;
+    int64_t _sampling_calls;
     std::map<std::string, int> _custom_int;
     std::map<std::string, unsigned> _custom_uint;
     std::map<std::string, int64_t> _custom_int64;
@@ -200,16 +479,86 @@ private:
     int64_t _timestamp;
 
     int _threads;
+    int _cpu;
+
+    int64_t _running_start;
+    int64_t _running_stop;
+    bool _overlap;
+    int64_t _start_skew;
+    int64_t _overlap_time;
+    int64_t _overlap_operations;
+
+    bool _overhead;
+    int64_t _overhead_time;
+    int64_t _overhead_latency;
+
+    std::vector<PhaseSample> _samples;
+    int64_t _samples_capacity;
+    bool _samples_reservoir;
+    uint64_t _samples_thread;
+    uint64_t _samples_random;
+    int64_t _total_samples;
 
-    void InitLatencyHistogram(const std::tuple<int64_t, int64_t, int>& latency) noexcept;
-    void PrintLatencyHistogram(FILE* file, int32_t resolution) const noexcept;
+    int64_t _interval_period;
+    uint64_t _interval_timestamp;
+    int64_t _interval_operations;
+    int64_t _interval_items;
+    int64_t _interval_bytes;
+    int64_t _interval_capacity;
+    void* _interval_histogram;
+    std::shared_ptr<void> _interval_current;
+    std::vector<std::shared_ptr<void>> _interval_pool;
+    std::vector<PhaseInterval> _intervals;
+
+    std::vector<PhaseAttempt> _attempts;
+    std::vector<std::shared_ptr<PhaseMetrics>> _attempt_metrics;
+    bool _attempt_metrics_keep;
+    PhaseStatistics _statistics;
+    std::vector<PhaseFairness> _fairness;
+
+    std::shared_ptr<Counters> _counters_group;
+    uint32_t _counters_mask;
+    Counters::Values _counters;
+    Counters::Values _counters_start;
+
+    bool _resources;
+    ResourceUsage _resource_usage;
+    ResourceUsage _resource_usage_start;
+
+    bool _allocations;
+    AllocationCounters _allocation_counters;
+    AllocationCounters _allocation_start;
+
+    void InitLatencyHistogram(const std::tuple<int64_t, int64_t, int>& latency, bool attempts) noexcept;
+    void PrintLatencyHistogram(FILE* file, int32_t resolution, int attempt) const noexcept;
+    void MergeLatencyHistograms(PhaseMetrics& metrics) noexcept;
+    void MergeIntervals(const PhaseMetrics& metrics);
     void FreeLatencyHistogram() noexcept;
 
+    void InitSamples(int64_t capacity, bool reservoir);
+    void InitIntervals(int64_t period, int64_t capacity);
+    void InitCounters();
+    void InitCounters(const std::shared_ptr<Counters>& group) noexcept;
+    void InitResources() noexcept;
+
     void StartCollecting() noexcept;
     void StopCollecting() noexcept;
 
+    void StartInterval(uint64_t timestamp) noexcept;
+    void UpdateInterval(uint64_t timestamp)
+    { if ((timestamp - _interval_timestamp) >= (uint64_t)_interval_period) AddInterval(timestamp); }
+    void StopInterval(uint64_t timestamp);
+    void AddInterval(uint64_t timestamp);
+    void CompactIntervals();
+
+    void KeepAttempts() noexcept { _attempt_metrics_keep = true; }
+    void AssignMetrics(const PhaseMetrics& metrics);
+    void AssignSamples(const PhaseMetrics& metrics);
+    void AppendSamples(const PhaseMetrics& metrics);
     void MergeMetrics(PhaseMetrics& metrics);
     void ResetMetrics() noexcept;
+
+    void UpdateStatistics(AttemptSelection selection, double outliers);
 };
 
 } // namespace CppBenchmark
@@ -48,6 +48,8 @@ public:
     void StopPhase() override;
     std::shared_ptr<PhaseScope> ScopePhase(const std::string& phase) override;
     std::shared_ptr<PhaseScope> ScopePhaseThreadSafe(const std::string& phase) override;
+    PhaseHandle ResolvePhase(const std::string& phase) override;
+    PhaseHandle ResolvePhaseThreadSafe(const std::string& phase) override;
 
 private:
     std::shared_ptr<Phase> _phase;
@@ -30,7 +30,7 @@ public:
 
         \param stream - Output stream
     */
-    ReporterCSV(std::ostream& stream = std::cout) : _stream(stream) {}
+    ReporterCSV(std::ostream& stream = std::cout) : _stream(stream), _clock(ClockType::Default) {}
     ReporterCSV(const ReporterCSV&) = delete;
     ReporterCSV(ReporterCSV&&) = delete;
     virtual ~ReporterCSV() = default;
@@ -40,10 +40,12 @@ public:
 
     // Implementation of Reporter
     void ReportHeader() override;
+    void ReportBenchmark(const BenchmarkBase& benchmark, const Settings& settings) override;
     void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override;
 
 private:
     std::ostream& _stream;
+    ClockType _clock;
 };
 
 } // namespace CppBenchmark
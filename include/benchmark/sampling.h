@@ -0,0 +1,97 @@
+/*!
+    \file sampling.h
+    \brief Dynamic benchmarks sampling policy definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_SAMPLING_H
+#define CPPBENCHMARK_SAMPLING_H
+
+#include <cstdint>
+
+namespace CppBenchmark {
+
+//! Sampling policy type
+enum class SamplingType
+{
+    None,           //!< Measure every call
+    Every,          //!< Measure every Nth call
+    Probability,    //!< Measure each call with the given probability
+    Budget          //!< Measure the given count of calls per second
+};
+
+//! Dynamic benchmarks sampling policy
+/*!
+    Sampling policy selects calls of the dynamic benchmark which are measured. Unsampled calls are only
+    counted, so instrumentation of frequent calls can be left in production code. Timing and latency are
+    calculated from sampled calls and total operations are estimated by the count of all calls.
+
+    Each policy is implemented as a countdown of calls till the next sampled call:
+    - Every policy samples each Nth call;
+    - Probability policy draws the countdown from the geometric distribution, so each call is sampled
+      with the given probability;
+    - Budget policy adapts the countdown to the calls rate observed between sampled calls.
+
+    Not thread-safe.
+*/
+class Sampling
+{
+public:
+    //! Default class constructor (measure every call)
+    Sampling() noexcept : _type(SamplingType::None), _every(1), _probability(1.0), _budget(0) {}
+    Sampling(const Sampling&) noexcept = default;
+    Sampling(Sampling&&) noexcept = default;
+    ~Sampling() = default;
+
+    Sampling& operator=(const Sampling&) noexcept = default;
+    Sampling& operator=(Sampling&&) noexcept = default;
+
+    //! Get sampling policy type
+    SamplingType type() const noexcept { return _type; }
+    //! Get count of calls per sampled call of Every policy
+    int64_t every() const noexcept { return _every; }
+    //! Get probability of the sampled call of Probability policy
+    double probability() const noexcept { return _probability; }
+    //! Get count of sampled calls per second of Budget policy
+    int64_t budget() const noexcept { return _budget; }
+
+    //! Create sampling policy which measures every Nth call
+    /*!
+        \param calls - Count of calls per sampled call (must be positive)
+        \return Sampling policy
+    */
+    static Sampling Every(int64_t calls) noexcept;
+    //! Create sampling policy which measures each call with the given probability
+    /*!
+        \param probability - Probability of the sampled call (0.0 - 1.0)
+        \return Sampling policy
+    */
+    static Sampling Probability(double probability) noexcept;
+    //! Create sampling policy which measures the given count of calls per second
+    /*!
+        \param calls - Count of sampled calls per second (must be positive)
+        \return Sampling policy
+    */
+    static Sampling Budget(int64_t calls) noexcept;
+
+    //! Calculate count of calls till the next sampled call
+    /*!
+        \param random - Random generator state
+        \param calls - Count of calls since the previous sampled call
+        \param duration - Duration since the previous sampled call (in nanoseconds)
+        \return Count of calls till the next sampled call (at least 1)
+    */
+    int64_t Stride(uint64_t& random, int64_t calls, int64_t duration) const noexcept;
+
+private:
+    SamplingType _type;
+    int64_t _every;
+    double _probability;
+    int64_t _budget;
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_SAMPLING_H
@@ -9,6 +9,10 @@
 #ifndef CPPBENCHMARK_SETTINGS_H
 #define CPPBENCHMARK_SETTINGS_H
 
+#include "benchmark/affinity.h"
+#include "benchmark/statistics.h"
+#include "benchmark/system.h"
+
 #include <cstdint>
 #include <functional>
 #include <tuple>
@@ -20,11 +24,26 @@ namespace CppBenchmark {
 /*!
     Provides interface to all benchmark settings:
     - Independent benchmark attempts (default is 5)
+    - Adaptive count of attempts until results converge (default is disabled)
     - Benchmark duration in seconds (default is 5)
     - Count of operations (default is 0)
+    - Warmup operations or duration discarded before measurements (default is disabled)
     - Add count of running threads to the benchmark running plan
     - Add count of producers/consumers to the benchmark running plan
     - Add parameters (single, pair, triple) to the benchmark running plan
+    - Latency histograms of each attempt (default is disabled)
+    - Timestamp clock (default is the launcher clock)
+    - Batched execution of operations (default is disabled)
+    - Harness overhead calibration (default is disabled)
+    - Samples collection of operations (default is disabled)
+    - Interval snapshots of operations (default is disabled)
+    - Attempt selection policy (default is the best attempt)
+    - Outlier attempts rejection (default is disabled)
+    - Performance counters collection (default is disabled)
+    - Resources usage collection (default is disabled)
+    - Threads placement policy (default is disabled)
+    - Throughput of the threads overlap window (default is disabled)
+    - Open-loop execution at the target operations rate (default is disabled)
 
     All settings can be configured using fluent syntax.
 */
@@ -49,14 +68,24 @@ public:
     Settings& operator=(const Settings&) = default;
     Settings& operator=(Settings&&) noexcept = default;
 
-    //! Get count of independent benchmark attempts
+    //! Get count of independent benchmark attempts (minimal count in adaptive mode)
     int attempts() const noexcept { return _attempts; }
+    //! Get maximal count of independent benchmark attempts
+    int attempts_max() const noexcept { return _attempts_max; }
+    //! Get target relative width of the throughput confidence interval (0 if adaptive mode is disabled)
+    double attempts_precision() const noexcept { return _attempts_precision; }
+    //! Is benchmark running adaptive count of attempts?
+    bool adaptive() const noexcept { return (_attempts_precision > 0) && (_attempts_max > _attempts); }
     //! Is benchmark running with infinite count of operations (until cancel)?
     bool infinite() const noexcept { return _infinite; }
     //! Get benchmark duration in milliseconds
     int64_t duration() const noexcept { return _duration; }
     //! Get count of operations
     int64_t operations() const noexcept { return _operations; }
+    //! Get count of warmup operations
+    int64_t warmup() const noexcept { return _warmup; }
+    //! Get warmup duration in milliseconds
+    int64_t warmup_duration() const noexcept { return _warmup_duration; }
     //! Get collection of independent threads counts in a benchmark plan
     const std::vector<int>& threads() const noexcept { return _threads; }
     //! Get collection of independent producers/consumers counts in a benchmark plan
@@ -67,6 +96,42 @@ public:
     const std::tuple<int64_t, int64_t, int>& latency() const noexcept { return _latency_params; }
     //! Get automatic latency update flag
     bool latency_auto() const noexcept { return _latency_auto; }
+    //! Are latency histograms of each attempt kept?
+    bool latency_attempts() const noexcept { return _latency_attempts; }
+    //! Get timestamp clock
+    ClockType clock() const noexcept { return _clock; }
+    //! Is benchmark running operations in batches?
+    bool batched() const noexcept { return _batched; }
+    //! Get batch size of operations (0 for automatic batch size)
+    int64_t batch() const noexcept { return _batch; }
+    //! Is harness overhead calibration enabled?
+    bool overhead() const noexcept { return _overhead; }
+    //! Get samples buffer capacity (0 if samples collection is disabled)
+    int64_t samples() const noexcept { return _samples; }
+    //! Get reservoir sampling flag
+    bool samples_reservoir() const noexcept { return _samples_reservoir; }
+    //! Get period of interval snapshots in milliseconds (0 if interval snapshots are disabled)
+    int64_t intervals() const noexcept { return _intervals; }
+    //! Get count of retained interval snapshots
+    int64_t intervals_capacity() const noexcept { return _intervals_capacity; }
+    //! Get attempt selection policy
+    AttemptSelection selection() const noexcept { return _selection; }
+    //! Get outlier attempts rejection threshold (0 if rejection is disabled)
+    double outliers() const noexcept { return _outliers; }
+    //! Is performance counters collection enabled?
+    bool counters() const noexcept { return _counters; }
+    //! Is resources usage collection enabled?
+    bool resources() const noexcept { return _resources; }
+    //! Get threads placement policy
+    AffinityPolicy affinity() const noexcept { return _affinity; }
+    //! Get explicit list of logical CPUs for threads placement
+    const std::vector<int>& affinity_cpus() const noexcept { return _affinity_cpus; }
+    //! Is throughput of the threads overlap window enabled?
+    bool overlap() const noexcept { return _overlap; }
+    //! Get target operations rate per thread in operations per second (0 for closed-loop execution)
+    double rate() const noexcept { return _rate; }
+    //! Is target operations rate using Poisson inter-arrival times?
+    bool rate_poisson() const noexcept { return _rate_poisson; }
 
     //! Set independent benchmark attempts
     /*!
@@ -76,6 +141,19 @@ public:
         \param attempts - Independent benchmark attempts (must be positive)
     */
     Settings& Attempts(int attempts);
+    //! Set adaptive count of independent benchmark attempts
+    /*!
+        Benchmark will be launched at least in the given minimal count of attempts. After that new attempts will
+        be launched until the relative width of the 95% confidence interval of the operations throughput
+        ((upper - lower) / mean) for all benchmark root phases becomes less than the given precision or the
+        maximal count of attempts is reached.
+
+        \param min - Minimal count of attempts (must be positive)
+        \param max - Maximal count of attempts (must be not less than minimal count)
+        \param precision - Target relative width of the throughput confidence interval (e.g. 0.02 for 2%)
+        \return Reference to the current settings instance
+    */
+    Settings& Attempts(int min, int max, double precision);
 
     //! Set infinite benchmark operations flag
     /*!
@@ -88,6 +166,24 @@ public:
         \return Reference to the current settings instance
     */
     Settings& Duration(int64_t duration);
+    //! Set count of warmup operations
+    /*!
+        Benchmark operations will be run the given count of times before the batch size calculation, the harness
+        overhead calibration and the measured operations. Results of warmup operations are discarded.
+
+        \param operations - Count of warmup operations (0 to disable warmup)
+        \return Reference to the current settings instance
+    */
+    Settings& Warmup(int64_t operations);
+    //! Set warmup duration in milliseconds
+    /*!
+        Benchmark operations will be run for the given duration before the batch size calculation, the harness
+        overhead calibration and the measured operations. Results of warmup operations are discarded.
+
+        \param duration - Warmup duration in milliseconds (0 to disable warmup)
+        \return Reference to the current settings instance
+    */
+    Settings& WarmupDuration(int64_t duration);
     //! Set count of operations
     /*!
         \param operations - Count of operations (must be positive)
@@ -277,17 +373,220 @@ public:
         \return Reference to the current settings instance
     */
     Settings& Latency(int64_t lowest, int64_t highest, int significant, bool automatic = true);
+    //! Keep latency histograms of each attempt
+    /*!
+        Latency histogram of the phase always combines all attempts and all threads. This option additionally
+        keeps the combined histogram of each attempt, which will be written into separate histogram files.
+
+        \return Reference to the current settings instance
+    */
+    Settings& LatencyAttempts();
+
+    //! Set timestamp clock
+    /*!
+        Timestamp clock is used to measure latency and duration of benchmark operations. Default clock will be
+        replaced with the launcher clock. CPU time-stamp counter clock will fallback to the monotonic clock if
+        the invariant time-stamp counter is not supported.
+
+        \param clock - Timestamp clock
+        \return Reference to the current settings instance
+    */
+    Settings& Clock(ClockType clock);
+
+    //! Set batched execution of operations
+    /*!
+        Benchmark operation method will be called several times between timestamps, so the harness overhead
+        (operations counting, stop checks and latency timestamps) is paid once per batch. Automatic batch size
+        is chosen to make each batch duration well above the timestamp clock resolution. Reported time and
+        latency values are per operation. Cancellation is checked once per batch.
+
+        Batched execution is supported for benchmarks, threads benchmarks and producers of producers/consumers
+        benchmarks.
+
+        \param size - Batch size of operations (default is 0 for automatic batch size)
+        \return Reference to the current settings instance
+    */
+    Settings& Batch(int64_t size = 0);
+
+    //! Enable harness overhead calibration
+    /*!
+        Before collecting metrics an empty operation will be launched through the same benchmark loop to measure
+        the harness overhead (operation method call, operations counting and latency timestamps). Measured
+        overhead will be subtracted from average/minimal/maximal time and latency values of corrected metrics.
+
+        \return Reference to the current settings instance
+    */
+    Settings& Overhead();
+
+    //! Set samples collection of operations
+    /*!
+        Timestamp, duration and thread of each operation (or each operations batch in batched execution mode)
+        will be stored into the preallocated samples buffer of the phase. When the buffer is full the oldest
+        sample will be overwritten. In the reservoir sampling mode the buffer will keep uniformly distributed
+        samples of the whole phase execution instead. Root phases of threads and producers/consumers benchmarks
+        combine samples of all their threads.
+
+        \param capacity - Samples buffer capacity (must be positive)
+        \param reservoir - Reservoir sampling flag (default is false)
+        \return Reference to the current settings instance
+    */
+    Settings& Samples(int64_t capacity, bool reservoir = false);
+    //! Set period of interval snapshots
+    /*!
+        Benchmark threads will snapshot operations, items, bytes and latency of each period while running
+        operations, so throughput changes of long or infinite benchmarks are visible over time. Snapshots are
+        taken by benchmark threads themselves at the operations loop checkpoints, workers are never stopped.
+
+        Launcher writes interval snapshots of each phase as the HdrHistogram interval log (<name>.hlog, if
+        latency is collected) and as JSON lines (<name>.intervals.json).
+
+        At most the given count of interval snapshots is retained. When it is reached, adjacent snapshots
+        are merged in pairs and the period is doubled, so snapshots always cover the whole phase execution.
+        Latency histograms of all retained snapshots are allocated before the operations loop is started.
+
+        \param period - Period of interval snapshots in milliseconds (0 to disable interval snapshots)
+        \param capacity - Count of retained interval snapshots (default is 64)
+        \return Reference to the current settings instance
+    */
+    Settings& Intervals(int64_t period, int64_t capacity = 64);
+
+    //! Set attempt selection policy
+    /*!
+        Selected attempt provides total time, operations, items, bytes and other metrics of the phase result
+        (custom values, counters, resources usage, heap allocations, samples and harness overhead). The best
+        attempt policy chooses the attempt with the lowest total execution time, while minimal and maximal times
+        and latency histogram are combined over all attempts. The median policy chooses the accepted attempt
+        with the median operations throughput and takes all metrics including minimal and maximal times and
+        latency histogram from it, so complete metrics of each attempt are kept till the end of the benchmark.
+
+        Throughput statistics (median, mean, MAD, CV and bootstrap confidence interval) are calculated over all
+        accepted attempts regardless of the selection policy.
+
+        \param selection - Attempt selection policy
+        \return Reference to the current settings instance
+    */
+    Settings& Selection(AttemptSelection selection);
+
+    //! Set outlier attempts rejection
+    /*!
+        Attempt will be rejected from statistics and median selection if the modified z-score of its operations
+        throughput is greater than the given threshold.
+
+        \param threshold - Modified z-score threshold (default is 3.5)
+        \return Reference to the current settings instance
+    */
+    Settings& Outliers(double threshold = 3.5);
+
+    //! Enable performance counters collection
+    /*!
+        Hardware performance counters (cycles, instructions, branch misses, L1D/LLC misses and dTLB misses)
+        and software events (task clock and page faults) will be collected for each benchmark thread while
+        measuring the phase. Unavailable counters are skipped, e.g. virtual machines without PMU or restrictive
+        perf_event_paranoid will provide only software events. Only Linux is supported now.
+
+        Reading counters requires a system call on each phase start/stop, so avoid enabling counters for
+        benchmarks with short nested phases.
+
+        \return Reference to the current settings instance
+    */
+    Settings& Counters();
+
+    //! Enable resources usage collection
+    /*!
+        Operating system resources usage (thread CPU time, user/system CPU time, minor/major page faults and
+        voluntary/involuntary context switches) will be collected for each benchmark thread while measuring
+        the phase. Ratio of the CPU time to the phase total time shows how long the phase was blocked or
+        preempted.
+
+        Reading resources usage requires system calls on each phase start/stop, so avoid enabling it for
+        benchmarks with short nested phases.
+
+        \return Reference to the current settings instance
+    */
+    Settings& Resources();
+
+    //! Set threads placement policy
+    /*!
+        Each thread of threads and producers/consumers benchmarks will be bound to the logical CPU planned by
+        the given policy before waiting at the start barrier. Chosen logical CPU is recorded into the thread
+        phase metrics. Pair policies (same core, same cache, different cache) place the i-th producer and the
+        i-th consumer together. Linux and Windows are supported now.
+
+        \param policy - Threads placement policy
+        \return Reference to the current settings instance
+    */
+    Settings& Affinity(AffinityPolicy policy);
+    //! Set explicit list of logical CPUs for threads placement
+    /*!
+        The i-th thread will be bound to the i-th logical CPU of the list (producers go before consumers).
+        If there are more threads than logical CPUs then the list will be reused from the beginning.
+
+        \param cpus - List of logical CPUs (must not be empty)
+        \return Reference to the current settings instance
+    */
+    Settings& Affinity(const std::vector<int>& cpus);
+
+    //! Enable throughput of the threads overlap window
+    /*!
+        Start skew (time between the first and the last thread passing the start barrier) and the overlap
+        window (time when all threads were running) are always measured for threads and producers/consumers
+        benchmarks. This option additionally estimates operations of all threads in the overlap window and
+        reports the throughput of the window, which excludes ramp-up and ramp-down of staggered threads.
+
+        \return Reference to the current settings instance
+    */
+    Settings& Overlap();
+
+    //! Set open-loop execution at the target operations rate
+    /*!
+        Each benchmark thread (each producer of producers/consumers benchmarks) will start its operations at
+        intended start times following the target rate instead of running them back to back. Inter-arrival
+        times are constant or exponentially distributed (Poisson arrivals). Latency of each operation is
+        measured from its intended start time, so stalls which delay following operations are visible in
+        the latency histogram instead of being silently omitted (coordinated omission).
+
+        If latency histogram parameters are not set yet, the default ones (1 ns - 1 minute, 3 significant
+        figures) will be used. Batched execution is ignored in the open-loop mode, warmup operations run at
+        the target rate as well. Timed runs stop at the deadline even if operations fall behind the rate.
+
+        \param rate - Target operations rate per thread in operations per second (must be positive)
+        \param poisson - Poisson inter-arrival times flag (default is false)
+        \return Reference to the current settings instance
+    */
+    Settings& Rate(double rate, bool poisson = false);
 
 private:
     int _attempts;
+    int _attempts_max;
+    double _attempts_precision;
     bool _infinite;
     int64_t _duration;
     int64_t _operations;
+    int64_t _warmup;
+    int64_t _warmup_duration;
     std::vector<int> _threads;
     std::vector<std::tuple<int, int>> _pc;
     std::vector<std::tuple<int, int, int>> _params;
     std::tuple<int64_t, int64_t, int> _latency_params;
     bool _latency_auto;
+    bool _latency_attempts;
+    ClockType _clock;
+    bool _batched;
+    int64_t _batch;
+    bool _overhead;
+    int64_t _samples;
+    bool _samples_reservoir;
+    int64_t _intervals;
+    int64_t _intervals_capacity;
+    AttemptSelection _selection;
+    double _outliers;
+    bool _counters;
+    bool _resources;
+    AffinityPolicy _affinity;
+    std::vector<int> _affinity_cpus;
+    bool _overlap;
+    double _rate;
+    bool _rate_poisson;
 };
 
 } // namespace CppBenchmark
@@ -0,0 +1,83 @@
+/*!
+    \file statistics.h
+    \brief Statistics definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_STATISTICS_H
+#define CPPBENCHMARK_STATISTICS_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace CppBenchmark {
+
+//! Attempt selection policy
+enum class AttemptSelection
+{
+    Best,       //!< Attempt with the lowest total execution time
+    Median      //!< Attempt with the median operations throughput
+};
+
+//! Statistics static class
+/*!
+    Provides robust statistics functionality to estimate benchmark results over independent attempts:
+    mean, median, median absolute deviation, coefficient of variation, bootstrap confidence interval
+    and outliers rejection. Also estimates fairness of benchmark threads with Jain's fairness index.
+*/
+class Statistics
+{
+public:
+    Statistics() = delete;
+    Statistics(const Statistics&) = delete;
+    Statistics(Statistics&&) = delete;
+    ~Statistics() = delete;
+
+    Statistics& operator=(const Statistics&) = delete;
+    Statistics& operator=(Statistics&&) = delete;
+
+    //! Calculate the arithmetic mean of the given values
+    static double Mean(const std::vector<double>& values);
+    //! Calculate the median of the given values
+    static double Median(const std::vector<double>& values);
+    //! Calculate the sample standard deviation of the given values
+    static double StdDev(const std::vector<double>& values);
+    //! Calculate the median absolute deviation of the given values
+    static double MAD(const std::vector<double>& values);
+    //! Calculate the coefficient of variation (standard deviation / mean) of the given values
+    static double CV(const std::vector<double>& values);
+    //! Calculate Jain's fairness index ((sum of values)^2 / (count * sum of squared values)) of the given values
+    /*!
+        Index is 1 if all values are equal and tends to 1 / count if a single value dominates.
+    */
+    static double JainIndex(const std::vector<double>& values);
+
+    //! Calculate the bootstrap confidence interval of the mean of the given values
+    /*!
+        Percentile bootstrap with a fixed random seed, so the result is reproducible for the same values.
+
+        \param values - Values
+        \param confidence - Confidence level (default is 0.95)
+        \param resamples - Count of bootstrap resamples (default is 1000)
+        \return Lower and upper bounds of the confidence interval
+    */
+    static std::pair<double, double> BootstrapCI(const std::vector<double>& values, double confidence = 0.95, int resamples = 1000);
+
+    //! Find outliers in the given values
+    /*!
+        Value is an outlier if its modified z-score (0.6745 * |value - median| / MAD) is greater than the given
+        threshold. No outliers are reported if the median absolute deviation is zero.
+
+        \param values - Values
+        \param threshold - Modified z-score threshold (default is 3.5)
+        \return Outliers flags for each value
+    */
+    static std::vector<bool> Outliers(const std::vector<double>& values, double threshold = 3.5);
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_STATISTICS_H
@@ -11,9 +11,50 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace CppBenchmark {
 
+//! Timestamp clock type
+enum class ClockType
+{
+    Default,    //!< Launcher default clock
+    Monotonic,  //!< Operating system monotonic clock
+    TSC         //!< CPU invariant time-stamp counter
+};
+
+//! Thread resources usage
+struct ResourceUsage
+{
+    //! Thread CPU time in nanoseconds
+    int64_t cpu_time;
+    //! User CPU time in nanoseconds
+    int64_t user_time;
+    //! System CPU time in nanoseconds
+    int64_t system_time;
+    //! Minor page faults (serviced without I/O)
+    int64_t minor_faults;
+    //! Major page faults (serviced with I/O)
+    int64_t major_faults;
+    //! Voluntary context switches (thread blocked)
+    int64_t voluntary_switches;
+    //! Involuntary context switches (thread preempted)
+    int64_t involuntary_switches;
+};
+
+//! CPU logical core topology
+struct CpuTopology
+{
+    //! Logical CPU index
+    int cpu;
+    //! Physical core Id (unique in the package)
+    int core;
+    //! Physical package (socket) Id
+    int package;
+    //! Last level cache Id (lowest logical CPU index sharing the cache)
+    int cache;
+};
+
 //! System management static class
 /*!
     Provides system management functionality to get CPU properties, RAM properties, current thread Id, etc.
@@ -41,6 +82,16 @@ public:
     static int64_t CpuClockSpeed();
     //! Is CPU Hyper-Threading enabled?
     static bool CpuHyperThreading();
+    //! Is CPU time-stamp counter invariant?
+    static bool CpuInvariantTSC();
+    //! CPU time-stamp counter calibrated frequency in Hz
+    static int64_t CpuTSCFrequency();
+    //! CPU topology of logical cores available for the current process
+    /*!
+        Linux reads the topology from sysfs and skips logical cores excluded by the process affinity mask.
+        Windows reads it from the logical processor information. Other platforms provide an empty collection.
+    */
+    static std::vector<CpuTopology> CpuTopologies();
 
     //! Total RAM in bytes
     static int64_t RamTotal();
@@ -49,9 +100,39 @@ public:
 
     //! Current thread Id
     static uint64_t CurrentThreadId();
+    //! Current thread resources usage
+    /*!
+        Linux provides all values for the current thread. Other Unix platforms provide page faults and context
+        switches for the whole process. Windows provides only CPU times.
+    */
+    static ResourceUsage CurrentThreadResourceUsage();
+    //! Bind the current thread to the given logical CPU
+    /*!
+        \param cpu - Logical CPU index (-1 to reset the affinity to all logical CPUs of the process)
+        \return 'true' if the current thread was bound, 'false' if the affinity is not supported or failed
+    */
+    static bool SetCurrentThreadAffinity(int cpu);
 
     //! Get the current timestamp in nanoseconds
     static uint64_t Timestamp();
+    //! Get the current timestamp in nanoseconds using the given clock
+    /*!
+        \param clock - Timestamp clock
+        \return Timestamp in nanoseconds
+    */
+    static uint64_t Timestamp(ClockType clock)
+    { return (clock == ClockType::TSC) ? TimestampTSC() : Timestamp(); }
+    //! Get the current CPU time-stamp counter timestamp in nanoseconds
+    /*!
+        Time-stamp counter is calibrated against the monotonic clock once, so both timestamps share the same time line.
+        If the invariant time-stamp counter is not supported the monotonic clock will be used.
+    */
+    static uint64_t TimestampTSC();
+
+    //! Get the given clock name
+    static std::string ClockName(ClockType clock);
+    //! Get the given clock frequency in Hz
+    static int64_t ClockFrequency(ClockType clock);
 
     //! Calculate (operant * multiplier / divider) with 64-bit unsigned integer values
     static uint64_t MulDiv64(uint64_t operant, uint64_t multiplier, uint64_t divider);
@@ -0,0 +1,96 @@
+/*!
+    \file thread_pool.h
+    \brief Persistent benchmark worker threads pool definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_THREAD_POOL_H
+#define CPPBENCHMARK_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CppBenchmark {
+
+//! Persistent benchmark worker threads pool
+/*!
+    Worker threads are created on demand and reused by all following runs, so threads and producers/consumers
+    benchmarks do not pay for thread creation, new stacks and empty thread-local storage in each launch.
+
+    Each worker remembers the logical CPU it is bound to and changes its affinity only when the next run
+    requests another placement. Workers not participating in the run stay idle.
+
+    Not thread-safe. Only one run could be performed at the same time.
+*/
+class ThreadPool
+{
+public:
+    //! Worker task (worker index, logical CPU the worker is bound to or -1)
+    typedef std::function<void (int, int)> Task;
+
+    ThreadPool() : _placement(nullptr), _task(nullptr), _generation(0), _count(0), _pending(0), _stop(false) {}
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    //! Get count of created worker threads
+    size_t size() const noexcept { return _workers.size(); }
+
+    //! Run the task on worker threads and wait for all of them
+    /*!
+        Task will be run once on each of first placement.size() worker threads. Missing workers will be created.
+
+        Will block.
+
+        \param placement - Logical CPU to bind each worker to (-1 to keep the worker unbound)
+        \param task - Task to run
+    */
+    void Run(const std::vector<int>& placement, const Task& task);
+    //! Warmup worker threads for the given placement
+    /*!
+        Creates missing worker threads and binds them to the given placement with an empty run, so the
+        following run with the same placement starts its task without thread creation and affinity changes.
+
+        Will block.
+
+        \param placement - Logical CPU to bind each worker to (-1 to keep the worker unbound)
+    */
+    void Warmup(const std::vector<int>& placement);
+
+    //! Get the benchmark worker threads pool shared by all benchmarks
+    static ThreadPool& Default();
+
+private:
+    struct Worker
+    {
+        std::thread thread;
+        int cpu;
+    };
+
+    std::mutex _mutex;
+    std::condition_variable _start;
+    std::condition_variable _finish;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    const std::vector<int>* _placement;
+    const Task* _task;
+    uint64_t _generation;
+    int _count;
+    int _pending;
+    bool _stop;
+
+    void Execute(Worker* worker, int index, uint64_t generation);
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_THREAD_POOL_H
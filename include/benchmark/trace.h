@@ -0,0 +1,108 @@
+/*!
+    \file trace.h
+    \brief Phases timeline trace recorder definition
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPBENCHMARK_TRACE_H
+#define CPPBENCHMARK_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace CppBenchmark {
+
+//! Trace event
+struct TraceEvent
+{
+    //! Event timestamp in nanoseconds
+    uint64_t timestamp;
+    //! Registered phase name
+    uint32_t name;
+    //! Is the phase begin event?
+    bool begin;
+};
+
+//! Phases timeline trace recorder static class
+/*!
+    Records begin/end events of benchmark phases (benchmark attempts, producers/consumers and threads phases,
+    child phases and dynamic benchmarks) into per-thread buffers and writes them in the Chrome trace event
+    JSON format which is viewed with chrome://tracing or Perfetto UI (https://ui.perfetto.dev).
+
+    Each thread appends events into its own fixed capacity buffer without locks and publishes them with
+    a single release store, so recording does not serialize benchmark threads. Phases of the same thread
+    are expected to be nested. Room for end events of all begun phases is reserved in the buffer, so begin
+    events which do not fit are dropped together with their nested phases and end events, and recorded
+    events are always paired. Dropped events are counted. Phase names are registered once per phase.
+
+    Thread-safe.
+*/
+class Trace
+{
+public:
+    Trace() = delete;
+    Trace(const Trace&) = delete;
+    Trace(Trace&&) = delete;
+    ~Trace() = delete;
+
+    Trace& operator=(const Trace&) = delete;
+    Trace& operator=(Trace&&) = delete;
+
+    //! Is trace recording enabled?
+    static bool enabled() noexcept { return _enabled.load(std::memory_order_relaxed); }
+    //! Get count of dropped events
+    static int64_t dropped() noexcept;
+
+    //! Enable trace recording
+    /*!
+        \param capacity - Capacity of the events buffer of each thread (default is 1048576)
+    */
+    static void Enable(size_t capacity = 1048576);
+    //! Disable trace recording
+    /*!
+        Recorded events are kept till Clear() method call.
+    */
+    static void Disable() noexcept;
+    //! Clear recorded events
+    /*!
+        Should not be called while events are recorded by other threads.
+    */
+    static void Clear();
+
+    //! Register the phase name
+    /*!
+        \param name - Phase name
+        \return Registered phase name
+    */
+    static uint32_t Register(const std::string& name);
+
+    //! Record the phase begin event in the current thread
+    /*!
+        \param name - Registered phase name
+    */
+    static void Begin(uint32_t name) noexcept { Record(name, true); }
+    //! Record the phase end event in the current thread
+    /*!
+        \param name - Registered phase name
+    */
+    static void End(uint32_t name) noexcept { Record(name, false); }
+
+    //! Write recorded events in the Chrome trace event JSON format
+    /*!
+        \param stream - Output stream
+    */
+    static void WriteJSON(std::ostream& stream);
+
+private:
+    static std::atomic<bool> _enabled;
+
+    static void Record(uint32_t name, bool begin) noexcept;
+};
+
+} // namespace CppBenchmark
+
+#endif // CPPBENCHMARK_TRACE_H
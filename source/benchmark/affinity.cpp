@@ -0,0 +1,242 @@
+/*!
+    \file affinity.cpp
+    \brief Benchmark threads placement implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/affinity.h"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+namespace CppBenchmark {
+
+//! @cond INTERNALS
+namespace Internals {
+
+typedef std::vector<CpuTopology> Core;
+
+// Group logical CPUs into physical cores ordered by package, cache and core Id
+std::vector<Core> PhysicalCores(std::vector<CpuTopology> topology)
+{
+    std::sort(topology.begin(), topology.end(), [](const CpuTopology& a, const CpuTopology& b)
+    {
+        return std::make_tuple(a.package, a.cache, a.core, a.cpu) < std::make_tuple(b.package, b.cache, b.core, b.cpu);
+    });
+
+    std::vector<Core> result;
+    for (const auto& cpu : topology)
+    {
+        if (result.empty() || (result.back().front().package != cpu.package) || (result.back().front().core != cpu.core))
+            result.emplace_back();
+        result.back().push_back(cpu);
+    }
+    return result;
+}
+
+// Group physical cores by the last level cache
+std::vector<std::vector<Core>> CacheGroups(const std::vector<Core>& cores)
+{
+    std::vector<std::vector<Core>> result;
+    for (const auto& core : cores)
+    {
+        if (result.empty() || (result.back().front().front().cache != core.front().cache))
+            result.emplace_back();
+        result.back().push_back(core);
+    }
+    return result;
+}
+
+std::vector<int> CompactOrder(const std::vector<Core>& cores)
+{
+    std::vector<int> result;
+    for (const auto& core : cores)
+        for (const auto& cpu : core)
+            result.push_back(cpu.cpu);
+    return result;
+}
+
+std::vector<int> NoSMTOrder(const std::vector<Core>& cores)
+{
+    std::vector<int> result;
+    for (const auto& core : cores)
+        result.push_back(core.front().cpu);
+    return result;
+}
+
+std::vector<int> ScatterOrder(const std::vector<Core>& cores)
+{
+    // Order logical CPUs by SMT sibling rank, core position in the cache group and cache group index
+    std::vector<std::tuple<size_t, size_t, size_t, int>> order;
+    auto groups = CacheGroups(cores);
+    for (size_t group = 0; group < groups.size(); ++group)
+        for (size_t position = 0; position < groups[group].size(); ++position)
+            for (size_t rank = 0; rank < groups[group][position].size(); ++rank)
+                order.emplace_back(rank, position, group, groups[group][position][rank].cpu);
+    std::sort(order.begin(), order.end());
+
+    std::vector<int> result;
+    for (const auto& item : order)
+        result.push_back(std::get<3>(item));
+    return result;
+}
+
+// Pair consecutive physical cores of the given collection
+void PairCores(const std::vector<Core>& cores, std::vector<std::pair<int, int>>& pairs)
+{
+    for (size_t i = 0; (i + 1) < cores.size(); i += 2)
+        pairs.emplace_back(cores[i].front().cpu, cores[i + 1].front().cpu);
+}
+
+std::vector<std::pair<int, int>> PlanPairs(AffinityPolicy policy, const std::vector<Core>& cores)
+{
+    std::vector<std::pair<int, int>> result;
+    if (cores.empty())
+        return result;
+
+    auto groups = CacheGroups(cores);
+
+    if (policy == AffinityPolicy::SameCore)
+    {
+        for (const auto& core : cores)
+            if (core.size() > 1)
+                result.emplace_back(core[0].cpu, core[1].cpu);
+    }
+
+    if ((policy == AffinityPolicy::DifferentCache) && (groups.size() > 1))
+    {
+        for (size_t group = 0; (group + 1) < groups.size(); group += 2)
+            for (size_t i = 0; (i < groups[group].size()) && (i < groups[group + 1].size()); ++i)
+                result.emplace_back(groups[group][i].front().cpu, groups[group + 1][i].front().cpu);
+    }
+
+    // Different cores of the same cache (also the fallback for other pair policies)
+    if (result.empty())
+    {
+        for (const auto& group : groups)
+            PairCores(group, result);
+    }
+
+    // Different cores regardless of the cache
+    if (result.empty())
+        PairCores(cores, result);
+
+    // Single physical core available
+    if (result.empty())
+        result.emplace_back(cores.front().front().cpu, cores.front().back().cpu);
+
+    return result;
+}
+
+bool IsPairPolicy(AffinityPolicy policy)
+{
+    return (policy == AffinityPolicy::SameCore) || (policy == AffinityPolicy::SameCache) || (policy == AffinityPolicy::DifferentCache);
+}
+
+} // namespace Internals
+//! @endcond
+
+const char* Affinity::Name(AffinityPolicy policy) noexcept
+{
+    switch (policy)
+    {
+        case AffinityPolicy::None:
+            return "none";
+        case AffinityPolicy::Compact:
+            return "compact";
+        case AffinityPolicy::Scatter:
+            return "scatter";
+        case AffinityPolicy::NoSMT:
+            return "no-smt";
+        case AffinityPolicy::List:
+            return "list";
+        case AffinityPolicy::SameCore:
+            return "same-core";
+        case AffinityPolicy::SameCache:
+            return "same-cache";
+        case AffinityPolicy::DifferentCache:
+            return "different-cache";
+        default:
+            return "<unknown>";
+    }
+}
+
+std::vector<int> Affinity::PlanThreads(AffinityPolicy policy, const std::vector<CpuTopology>& topology, const std::vector<int>& cpus, int threads)
+{
+    std::vector<int> result(threads, -1);
+
+    if (policy == AffinityPolicy::List)
+    {
+        if (!cpus.empty())
+            for (int i = 0; i < threads; ++i)
+                result[i] = cpus[i % cpus.size()];
+        return result;
+    }
+
+    auto cores = Internals::PhysicalCores(topology);
+    if ((policy == AffinityPolicy::None) || cores.empty())
+        return result;
+
+    // Consecutive threads are placed as pairs
+    if (Internals::IsPairPolicy(policy))
+    {
+        auto pairs = Internals::PlanPairs(policy, cores);
+        for (int i = 0; i < threads; ++i)
+        {
+            const auto& pair = pairs[(i / 2) % pairs.size()];
+            result[i] = ((i % 2) == 0) ? pair.first : pair.second;
+        }
+        return result;
+    }
+
+    std::vector<int> order;
+    if (policy == AffinityPolicy::Compact)
+        order = Internals::CompactOrder(cores);
+    else if (policy == AffinityPolicy::Scatter)
+        order = Internals::ScatterOrder(cores);
+    else if (policy == AffinityPolicy::NoSMT)
+        order = Internals::NoSMTOrder(cores);
+    else
+        return result;
+
+    for (int i = 0; i < threads; ++i)
+        result[i] = order[i % order.size()];
+    return result;
+}
+
+std::vector<int> Affinity::PlanProducersConsumers(AffinityPolicy policy, const std::vector<CpuTopology>& topology, const std::vector<int>& cpus, int producers, int consumers)
+{
+    if (!Internals::IsPairPolicy(policy))
+        return PlanThreads(policy, topology, cpus, producers + consumers);
+
+    std::vector<int> result(producers + consumers, -1);
+
+    auto cores = Internals::PhysicalCores(topology);
+    if (cores.empty())
+        return result;
+
+    // The i-th producer and the i-th consumer are placed as a pair
+    auto pairs = Internals::PlanPairs(policy, cores);
+    for (int i = 0; i < producers; ++i)
+        result[i] = pairs[i % pairs.size()].first;
+    for (int i = 0; i < consumers; ++i)
+        result[producers + i] = pairs[i % pairs.size()].second;
+    return result;
+}
+
+std::vector<int> Affinity::PlanJobs(const std::vector<CpuTopology>& topology, int jobs, bool spread)
+{
+    auto cores = Internals::PhysicalCores(topology);
+    if (cores.empty())
+        return std::vector<int>(std::max(jobs, 0), -1);
+
+    // Scatter order starts with the first SMT sibling of each physical core
+    std::vector<int> result = spread ? Internals::ScatterOrder(cores) : Internals::NoSMTOrder(cores);
+    result.resize(std::min(cores.size(), (size_t)std::max(jobs, 0)));
+    return result;
+}
+
+} // namespace CppBenchmark
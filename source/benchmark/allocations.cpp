@@ -0,0 +1,132 @@
+/*!
+    \file allocations.cpp
+    \brief Heap allocations tracker implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/allocations.h"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+#include <malloc.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <malloc.h>
+#endif
+
+namespace CppBenchmark {
+
+//! @cond INTERNALS
+namespace Internals {
+
+thread_local AllocationCounters allocations = { 0, 0, 0, 0, 0 };
+
+size_t AllocationSize(void* ptr, size_t alignment) noexcept
+{
+#if defined(__APPLE__)
+    return malloc_size(ptr);
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    return malloc_usable_size(ptr);
+#elif defined(_WIN32) || defined(_WIN64)
+    return (alignment > 0) ? _aligned_msize(ptr, alignment, 0) : _msize(ptr);
+#else
+    return 0;
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+bool Allocations::_enabled = false;
+
+AllocationCounters& Allocations::current() noexcept
+{
+    return Internals::allocations;
+}
+
+void* Allocations::Allocate(size_t size, size_t alignment) noexcept
+{
+    // Zero sized allocations must return unique pointers
+    if (size == 0)
+        size = 1;
+
+    void* result = nullptr;
+    if (alignment > 0)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        result = _aligned_malloc(size, alignment);
+#else
+        if (posix_memalign(&result, (alignment < sizeof(void*)) ? sizeof(void*) : alignment, size) != 0)
+            result = nullptr;
+#endif
+    }
+    else
+        result = std::malloc(size);
+
+    if (result != nullptr)
+    {
+        AllocationCounters& counters = Internals::allocations;
+        int64_t bytes = (int64_t)Internals::AllocationSize(result, alignment);
+        counters.allocations++;
+        counters.bytes += bytes;
+        counters.live += bytes;
+        if (counters.live > counters.peak)
+            counters.peak = counters.live;
+    }
+
+    return result;
+}
+
+void* Allocations::New(size_t size, size_t alignment)
+{
+    for (;;)
+    {
+        void* result = Allocate(size, alignment);
+        if (result != nullptr)
+            return result;
+
+        // Let the new handler free some memory or throw
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* Allocations::NewNoThrow(size_t size, size_t alignment) noexcept
+{
+    try
+    {
+        return New(size, alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void Allocations::Deallocate(void* ptr, size_t alignment) noexcept
+{
+    if (ptr == nullptr)
+        return;
+
+    AllocationCounters& counters = Internals::allocations;
+    counters.frees++;
+    counters.live -= (int64_t)Internals::AllocationSize(ptr, alignment);
+
+#if defined(_WIN32) || defined(_WIN64)
+    if (alignment > 0)
+    {
+        _aligned_free(ptr);
+        return;
+    }
+#endif
+    std::free(ptr);
+}
+
+} // namespace CppBenchmark
@@ -9,42 +9,102 @@
 #include "benchmark/barrier.h"
 
 #include <cassert>
+#include <climits>
+#include <thread>
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
 
 namespace CppBenchmark {
 
-Barrier::Barrier(int threads) noexcept : _counter(threads), _generation(0), _threads(threads)
+//! @cond INTERNALS
+namespace Internals {
+
+// Hint the CPU that the current thread is spinning
+inline void CpuRelax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+Barrier::Barrier(int threads, int64_t spin) noexcept
+    : _counter(threads),
+      _generation(0),
+      _threads(threads),
+      _spin((std::thread::hardware_concurrency() > 1) ? spin : 0)
 {
     assert((threads > 0) && "Barrier threads counter must be greater than zero!");
 }
 
 bool Barrier::Wait() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
     // Remember the current barrier generation
-    int generation = _generation;
+    int generation = _generation.load(std::memory_order_acquire);
 
     // Decrease the count of waiting threads
-    if (--_counter == 0)
+    if (_counter.fetch_sub(1, std::memory_order_acq_rel) == 1)
     {
-        // Increase the current barrier generation
-        ++_generation;
+        // Reset waiting threads counter before the next generation is visible
+        _counter.store(_threads, std::memory_order_relaxed);
 
-        // Reset waiting threads counter
-        _counter = _threads;
+        // Increase the current barrier generation
+        _generation.fetch_add(1, std::memory_order_release);
 
-        // Notify all waiting threads
-        _cond.notify_all();
+        // Notify all blocked threads
+        Release();
 
         // Notify the last thread that reached the barrier
         return true;
     }
 
-    // Wait for the next barrier generation
-    _cond.wait(lock, [&, this]() { return generation != _generation; });
+    // Spin for the next barrier generation
+    for (int64_t i = 0; i < _spin; ++i)
+    {
+        if (_generation.load(std::memory_order_acquire) != generation)
+            return false;
+        Internals::CpuRelax();
+    }
+
+    // Block until the next barrier generation
+    while (_generation.load(std::memory_order_acquire) == generation)
+        Block(generation);
 
     // Notify each of remaining threads
     return false;
 }
 
+void Barrier::Block(int generation) noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    syscall(SYS_futex, (int*)&_generation, FUTEX_WAIT_PRIVATE, generation, nullptr, nullptr, 0);
+#else
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.wait(lock, [&, this]() { return generation != _generation.load(std::memory_order_acquire); });
+#endif
+}
+
+void Barrier::Release() noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    syscall(SYS_futex, (int*)&_generation, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cond.notify_all();
+#endif
+}
+
 } // namespace CppBenchmark
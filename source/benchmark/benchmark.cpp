@@ -17,11 +17,17 @@ int Benchmark::CountLaunches() const
     return _settings.attempts() * (_settings.params().empty() ? 1 : (int)_settings.params().size());
 }
 
-void Benchmark::Launch(int& current, int total, LauncherHandler& handler)
+void Benchmark::Launch(int& current, int& total, ClockType clock, LauncherHandler& handler)
 {
+    _clock = clock;
+
     // Make several attempts of execution...
-    for (int attempt = 1; attempt <= _settings.attempts(); ++attempt)
+    for (int attempt = 1; attempt <= _settings.attempts_max(); ++attempt)
     {
+        // Extend the estimated launches count for the extra attempt
+        if (attempt > _settings.attempts())
+            total += CountLaunches() / _settings.attempts();
+
         // Run benchmark at least once
         if (_settings._params.empty())
             _settings._params.emplace_back(-1, -1, -1);
@@ -37,8 +43,7 @@ void Benchmark::Launch(int& current, int total, LauncherHandler& handler)
 
             // Initialize latency histogram of the current phase
             std::tuple<int64_t, int64_t, int> latency_params(_settings.latency());
-            bool latency_auto = _settings.latency_auto();
-            context._current->InitLatencyHistogram(latency_params);
+            context._current->InitLatencyHistogram(latency_params, _settings.latency_attempts());
 
             // Call launching notification...
             handler.onLaunching(++current, total, *this, context, attempt);
@@ -50,50 +55,10 @@ void Benchmark::Launch(int& current, int total, LauncherHandler& handler)
             int64_t duration = _settings.duration();
             int64_t operations = _settings.operations();
 
-            uint64_t timestamp = 0;
-
-            // Calculate the approximate count of operations which can be performed for the given duration
-            if (duration > 0)
-            {
-                uint64_t count = 0;
-                uint64_t timespan = 0;
-
-                // Collect data for one second...
-                for (; timespan < 1000000000; ++count)
-                {
-                    timestamp = System::Timestamp();
-
-                    // Run benchmark method...
-                    Run(context);
-
-                    timespan += System::Timestamp() - timestamp;
-                }
-
-                // Approximate operations count
-                operations = (1000000000ull * count * duration) / timespan;
-            }
-
-            context._current->StartCollectingMetrics();
-            while (!context.canceled() && (infinite || (operations > 0)))
-            {
-                // Add new metrics operation
-                context._metrics->AddOperations(1);
-
-                // Store the timestamp for the automatic latency update
-                if (latency_auto)
-                    timestamp = System::Timestamp();
-
-                // Run benchmark method...
-                Run(context);
-
-                // Update latency metrics
-                if (latency_auto)
-                    context._metrics->AddLatency(System::Timestamp() - timestamp);
-
-                // Decrement operation counters
-                operations -= 1;
-            }
-            context._current->StopCollectingMetrics();
+            // Run benchmark operations...
+            RunOperations(context, infinite, duration, operations, _settings.batched(), true,
+                [this, &context]() { Run(context); },
+                [&context]() { return context.canceled(); });
 
             // Call cleanup benchmark method...
             Cleanup(context);
@@ -104,6 +69,10 @@ void Benchmark::Launch(int& current, int total, LauncherHandler& handler)
 
         // Update benchmark root metrics for the current attempt
         UpdateBenchmarkMetrics(_phases);
+
+        // Stop making attempts when benchmark results converge
+        if (IsBenchmarkConverged(_phases, _settings, attempt))
+            break;
     }
 
     // Update benchmark threads
@@ -112,6 +81,9 @@ void Benchmark::Launch(int& current, int total, LauncherHandler& handler)
     // Update benchmark names
     UpdateBenchmarkNames(_phases);
 
+    // Update benchmark statistics
+    UpdateBenchmarkStatistics(_phases, _settings);
+
     // Update benchmark launched flag
     _launched = true;
 }
@@ -22,6 +22,8 @@ void BenchmarkBase::InitBenchmarkContext(Context& context)
     if (it == _phases.end())
     {
         result = std::make_shared<PhaseCore>(name);
+        if (_settings.selection() == AttemptSelection::Median)
+            result->_metrics_result.KeepAttempts();
         _phases.emplace_back(result);
     }
     else
@@ -32,6 +34,10 @@ void BenchmarkBase::InitBenchmarkContext(Context& context)
     context._metrics = &result->current();
 }
 
+void BenchmarkBase::EmptyOperation(Context& context)
+{
+}
+
 void BenchmarkBase::UpdateBenchmarkMetrics(std::vector<std::shared_ptr<PhaseCore>>& phases)
 {
     for (const auto& phase : phases)
@@ -75,6 +81,78 @@ void BenchmarkBase::UpdateBenchmarkThreads(std::vector<std::shared_ptr<PhaseCore
         UpdateBenchmarkThreads(phase->_child);
 }
 
+void BenchmarkBase::UpdateBenchmarkCounters(std::vector<std::shared_ptr<PhaseCore>>& phases)
+{
+    for (const auto& phase : phases)
+    {
+        PhaseMetrics& metrics = phase->_metrics_result;
+
+        // Skip phases with own performance counters
+        if (metrics.counters())
+            continue;
+
+        // Sum performance counters of all benchmark threads
+        for (const auto& child : phase->_child)
+        {
+            metrics._counters_mask |= child->metrics()._counters_mask;
+            for (int i = 0; i < Counters::COUNT; ++i)
+                metrics._counters[i] += child->metrics()._counters[i];
+        }
+    }
+}
+
+void BenchmarkBase::UpdateBenchmarkResources(std::vector<std::shared_ptr<PhaseCore>>& phases)
+{
+    for (const auto& phase : phases)
+    {
+        PhaseMetrics& metrics = phase->_metrics_result;
+
+        // Skip phases with own resources usage
+        if (metrics.resources())
+            continue;
+
+        // Sum resources usage of all benchmark threads
+        for (const auto& child : phase->_child)
+        {
+            if (!child->metrics().resources())
+                continue;
+
+            const ResourceUsage& usage = child->metrics().resource_usage();
+            metrics._resources = true;
+            metrics._resource_usage.cpu_time += usage.cpu_time;
+            metrics._resource_usage.user_time += usage.user_time;
+            metrics._resource_usage.system_time += usage.system_time;
+            metrics._resource_usage.minor_faults += usage.minor_faults;
+            metrics._resource_usage.major_faults += usage.major_faults;
+            metrics._resource_usage.voluntary_switches += usage.voluntary_switches;
+            metrics._resource_usage.involuntary_switches += usage.involuntary_switches;
+        }
+    }
+}
+
+void BenchmarkBase::UpdateBenchmarkAllocations(std::vector<std::shared_ptr<PhaseCore>>& phases)
+{
+    for (const auto& phase : phases)
+    {
+        PhaseMetrics& metrics = phase->_metrics_result;
+
+        // Add heap allocations of all benchmark threads (the sum of the threads peaks is an upper bound of the real peak)
+        for (const auto& child : phase->_child)
+        {
+            if (!child->metrics().allocations())
+                continue;
+
+            const AllocationCounters& counters = child->metrics().allocation_counters();
+            metrics._allocations = true;
+            metrics._allocation_counters.allocations += counters.allocations;
+            metrics._allocation_counters.frees += counters.frees;
+            metrics._allocation_counters.bytes += counters.bytes;
+            metrics._allocation_counters.live += counters.live;
+            metrics._allocation_counters.peak += counters.peak;
+        }
+    }
+}
+
 void BenchmarkBase::UpdateBenchmarkNames(std::vector<std::shared_ptr<PhaseCore>>& phases)
 {
     for (const auto& phase : phases)
@@ -99,6 +177,189 @@ void BenchmarkBase::UpdateBenchmarkOperations(PhaseCore& phase)
     phase._metrics_result.AddOperations(-1);
     for (const auto& child : phase._child)
         phase._metrics_result.AddOperations(child->metrics().threads() * child->metrics().total_operations());
+
+    // Update operations of the phase attempts in the same way
+    for (size_t i = 0; i < phase._metrics_result._attempts.size(); ++i)
+    {
+        int64_t operations = 0;
+        for (const auto& child : phase._child)
+            if (i < child->metrics().attempts().size())
+                operations += child->metrics().threads() * child->metrics().attempts()[i].total_operations;
+        phase._metrics_result._attempts[i].total_operations = operations;
+    }
+}
+
+void BenchmarkBase::UpdateBenchmarkLatency(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix)
+{
+    for (const auto& phase : phases)
+        for (const auto& child : phase->_child)
+            if (child->name().compare(0, prefix.size(), prefix) == 0)
+                phase->_metrics_result.MergeLatencyHistograms(child->_metrics_result);
+}
+
+void BenchmarkBase::UpdateBenchmarkIntervals(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix)
+{
+    for (const auto& phase : phases)
+        for (const auto& child : phase->_child)
+            if (child->name().compare(0, prefix.size(), prefix) == 0)
+                phase->_metrics_result.MergeIntervals(child->_metrics_result);
+}
+
+void BenchmarkBase::UpdateBenchmarkSamples(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix)
+{
+    for (const auto& phase : phases)
+        for (const auto& child : phase->_child)
+            if (child->name().compare(0, prefix.size(), prefix) == 0)
+                phase->_metrics_result.AppendSamples(child->_metrics_result);
+}
+
+void BenchmarkBase::UpdateBenchmarkFairness(std::vector<std::shared_ptr<PhaseCore>>& phases, const std::string& prefix)
+{
+    for (const auto& phase : phases)
+    {
+        // Collect benchmark threads of the given role
+        std::vector<const PhaseCore*> threads;
+        for (const auto& child : phase->_child)
+            if (child->name().compare(0, prefix.size(), prefix) == 0)
+                threads.push_back(child.get());
+        if (threads.empty())
+            continue;
+
+        PhaseFairness fairness = PhaseFairness();
+        fairness.role = prefix.substr(0, prefix.find_last_not_of('-') + 1);
+        fairness.threads = (int)threads.size();
+
+        // Estimate fairness of benchmark threads in each launch and average it over all launches
+        int launches = 0;
+        for (size_t i = 0; ; ++i)
+        {
+            // Collect operations throughput of benchmark threads in the same launch
+            std::vector<double> values;
+            for (const auto& thread : threads)
+                if (i < thread->metrics().attempts().size())
+                    values.push_back(thread->metrics().attempts()[i].operations_per_second());
+            if (values.empty())
+                break;
+            if (values.size() < threads.size())
+                continue;
+
+            fairness.min += *std::min_element(values.begin(), values.end());
+            fairness.max += *std::max_element(values.begin(), values.end());
+            fairness.mean += Statistics::Mean(values);
+            fairness.stdv += Statistics::StdDev(values);
+            fairness.jain += Statistics::JainIndex(values);
+            ++launches;
+        }
+        if (launches == 0)
+            continue;
+
+        fairness.min /= launches;
+        fairness.max /= launches;
+        fairness.mean /= launches;
+        fairness.stdv /= launches;
+        fairness.jain /= launches;
+        phase->_metrics_result._fairness.push_back(fairness);
+    }
+}
+
+void BenchmarkBase::UpdateBenchmarkOverlap(PhaseMetrics& metrics, const std::vector<std::tuple<int64_t, int64_t, int64_t>>& running, bool operations)
+{
+    if (running.empty())
+        return;
+
+    int64_t first_start = std::numeric_limits<int64_t>::max();
+    int64_t last_start = std::numeric_limits<int64_t>::min();
+    int64_t first_stop = std::numeric_limits<int64_t>::max();
+    for (const auto& thread : running)
+    {
+        first_start = std::min(first_start, std::get<0>(thread));
+        last_start = std::max(last_start, std::get<0>(thread));
+        first_stop = std::min(first_stop, std::get<1>(thread));
+    }
+
+    int64_t skew = last_start - first_start;
+    int64_t window = std::max(first_stop - last_start, (int64_t)0);
+
+    // Estimate operations of each thread in the overlap window
+    int64_t total = -1;
+    if (operations)
+    {
+        double estimated = 0.0;
+        for (const auto& thread : running)
+        {
+            int64_t duration = std::get<1>(thread) - std::get<0>(thread);
+            if (duration > 0)
+                estimated += (double)std::get<2>(thread) * window / duration;
+        }
+        total = (int64_t)estimated;
+    }
+
+    metrics.SetOverlap(skew, window, total);
+}
+
+bool BenchmarkBase::IsBenchmarkConverged(const std::vector<std::shared_ptr<PhaseCore>>& phases, const Settings& settings, int attempt, bool threads)
+{
+    if (attempt < settings.attempts())
+        return false;
+    if ((attempt >= settings.attempts_max()) || !settings.adaptive())
+        return true;
+
+    for (const auto& phase : phases)
+    {
+        // Get operations throughput of all phase attempts
+        std::vector<double> values;
+        const std::vector<PhaseAttempt>& attempts = phase->metrics().attempts();
+        for (size_t i = 0; i < attempts.size(); ++i)
+        {
+            PhaseAttempt item = attempts[i];
+
+            // Sum operations of benchmark threads in the same way as UpdateBenchmarkOperations()
+            if (threads)
+            {
+                item.total_operations = 0;
+                for (const auto& child : phase->_child)
+                    if (i < child->metrics().attempts().size())
+                        item.total_operations += child->metrics().threads() * child->metrics().attempts()[i].total_operations;
+            }
+
+            values.push_back(item.operations_per_second());
+        }
+
+        // Skip outlier attempts
+        if (settings.outliers() > 0)
+        {
+            std::vector<bool> rejected = Statistics::Outliers(values, settings.outliers());
+            std::vector<double> accepted;
+            for (size_t i = 0; i < values.size(); ++i)
+                if (!rejected[i])
+                    accepted.push_back(values[i]);
+            values.swap(accepted);
+        }
+
+        if (values.size() < 2)
+            return false;
+
+        // Check the relative width of the throughput confidence interval
+        std::pair<double, double> ci = Statistics::BootstrapCI(values);
+        double mean = Statistics::Mean(values);
+        if ((mean > 0) && (((ci.second - ci.first) / mean) > settings.attempts_precision()))
+            return false;
+    }
+
+    return true;
+}
+
+void BenchmarkBase::UpdateBenchmarkStatistics(std::vector<std::shared_ptr<PhaseCore>>& phases, const Settings& settings)
+{
+    for (const auto& phase : phases)
+        UpdateBenchmarkStatistics(*phase, settings);
+}
+
+void BenchmarkBase::UpdateBenchmarkStatistics(PhaseCore& phase, const Settings& settings)
+{
+    for (const auto& child : phase._child)
+        UpdateBenchmarkStatistics(*child, settings);
+    phase.UpdateStatistics(settings.selection(), settings.outliers());
 }
 
 } // namespace CppBenchmark
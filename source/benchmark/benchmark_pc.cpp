@@ -10,6 +10,8 @@
 
 #include "benchmark/barrier.h"
 #include "benchmark/launcher_handler.h"
+#include "benchmark/system.h"
+#include "benchmark/thread_pool.h"
 
 namespace CppBenchmark {
 
@@ -18,11 +20,22 @@ int BenchmarkPC::CountLaunches() const
     return _settings.attempts() * (_settings.pc().empty() ? 1 : (int)_settings.pc().size()) * (_settings.params().empty() ? 1 : (int)_settings.params().size());
 }
 
-void BenchmarkPC::Launch(int& current, int total, LauncherHandler& handler)
+void BenchmarkPC::Launch(int& current, int& total, ClockType clock, LauncherHandler& handler)
 {
+    _clock = clock;
+
+    // Prepare CPU topology for threads placement
+    std::vector<CpuTopology> topology;
+    if (_settings.affinity() != AffinityPolicy::None)
+        topology = System::CpuTopologies();
+
     // Make several attempts of execution...
-    for (int attempt = 1; attempt <= _settings.attempts(); ++attempt)
+    for (int attempt = 1; attempt <= _settings.attempts_max(); ++attempt)
     {
+        // Extend the estimated launches count for the extra attempt
+        if (attempt > _settings.attempts())
+            total += CountLaunches() / _settings.attempts();
+
         // Run benchmark at least for 1 producer and 1 consumer
         if (_settings._pc.empty())
             _settings._pc.emplace_back(1, 1);
@@ -48,7 +61,6 @@ void BenchmarkPC::Launch(int& current, int total, LauncherHandler& handler)
 
                 // Prepare latency histogram parameters
                 std::tuple<int64_t, int64_t, int> latency_params(_settings.latency());
-                bool latency_auto = _settings.latency_auto();
 
                 // Call launching notification...
                 handler.onLaunching(++current, total, *this, context, attempt);
@@ -60,162 +72,135 @@ void BenchmarkPC::Launch(int& current, int total, LauncherHandler& handler)
                 int64_t duration = _settings.duration();
                 int64_t operations = _settings.operations();
 
-                // Prepare barrier for producers & consumers threads
+                // Plan logical CPUs for producers & consumers threads
+                std::vector<int> placement = Affinity::PlanProducersConsumers(_settings.affinity(), topology, _settings.affinity_cpus(), producers, consumers);
+
+                // Prepare barrier and running timestamps for producers & consumers threads
                 Barrier barrier(producers + consumers);
+                std::vector<std::tuple<int64_t, int64_t, int64_t>> running(producers + consumers);
+
+                // Create and bind worker threads before the root phase is measured
+                ThreadPool::Default().Warmup(placement);
 
                 // Start benchmark root phase operation
                 context._current->StartCollectingMetrics();
                 context._metrics->AddOperations(1);
 
-                // Start benchmark producers
-                for (int i = 0; i < producers; ++i)
+                // Prepare benchmark producer task
+                auto producer = [this, &barrier, &running, &context, latency_params, producers, infinite, operations, duration](int i, int cpu)
                 {
-                    _threads.emplace_back([this, &barrier, &context, latency_params, latency_auto, producers, infinite, operations, duration, i]()
-                    {
-                        // Clone producer context
-                        ContextPC producer_context(context);
-
-                        // Create and start thread safe phase
-                        std::shared_ptr<Phase> producer_phase = context.StartPhaseThreadSafe("producer-" + std::to_string(i));
-                        PhaseCore* producer_phase_core = dynamic_cast<PhaseCore*>(producer_phase.get());
-
-                        // Update producer context
-                        producer_context._current = producer_phase_core;
-                        producer_context._metrics = &producer_phase_core->current();
-                        producer_context._metrics->AddOperations(-1);
-                        producer_context._metrics->SetThreads(producers);
-
-                        // Initialize latency histogram of the current phase
-                        producer_context._current->InitLatencyHistogram(latency_params);
-
-                        // Call initialize producer method...
-                        InitializeProducer(producer_context);
-
-                        bool producer_infinite = infinite;
-                        int64_t producer_duration = duration;
-                        int64_t producer_operations = operations;
-
-                        uint64_t timestamp = 0;
-
-                        // Wait for other threads at the barrier
-                        barrier.Wait();
-
-                        // Calculate the approximate count of operations which can be performed for the given duration
-                        if (producer_duration > 0)
-                        {
-                            uint64_t count = 0;
-                            uint64_t timespan = 0;
+                    // Clone producer context
+                    ContextPC producer_context(context);
 
-                            // Collect data for one second...
-                            for (; timespan < 1000000000; ++count)
-                            {
-                                timestamp = System::Timestamp();
+                    // Create and start thread safe phase
+                    std::shared_ptr<Phase> producer_phase = context.StartPhaseThreadSafe("producer-" + std::to_string(i));
+                    PhaseCore* producer_phase_core = dynamic_cast<PhaseCore*>(producer_phase.get());
 
-                                // Run producer method...
-                                RunProducer(producer_context);
+                    // Update producer context
+                    producer_context._current = producer_phase_core;
+                    producer_context._metrics = &producer_phase_core->current();
+                    producer_context._metrics->AddOperations(-1);
+                    producer_context._metrics->SetThreads(producers);
+                    producer_context._metrics->SetCpu(cpu);
 
-                                timespan += System::Timestamp() - timestamp;
-                            }
+                    // Initialize latency histogram of the current phase
+                    producer_context._current->InitLatencyHistogram(latency_params, _settings.latency_attempts());
 
-                            // Approximate operations count
-                            producer_operations = (1000000000ull * count * producer_duration) / timespan;
-                        }
+                    // Call initialize producer method...
+                    InitializeProducer(producer_context);
 
-                        producer_context._current->StartCollectingMetrics();
-                        while (!producer_context.produce_stopped() && !producer_context.canceled() && (producer_infinite || (producer_operations > 0)))
-                        {
-                            // Add new metrics operation
-                            producer_context._metrics->AddOperations(1);
+                    // Prepare producer operations...
+                    auto run = [this, &producer_context]() { RunProducer(producer_context); };
+                    auto stopped = [&producer_context]() { return producer_context.produce_stopped() || producer_context.canceled(); };
+                    int64_t batch = PrepareOperations(producer_context, infinite, duration, operations, _settings.batched(), true, run, stopped);
 
-                            // Store the timestamp for the automatic latency update
-                            if (latency_auto)
-                                timestamp = System::Timestamp();
+                    // Wait for other threads at the start barrier
+                    barrier.Wait();
+                    int64_t start = System::Timestamp();
 
-                            // Run producer method...
-                            RunProducer(producer_context);
+                    // Run producer operations...
+                    MeasureOperations(producer_context, infinite, duration, operations, batch, true, run, stopped);
 
-                            // Update latency metrics
-                            if (latency_auto)
-                                producer_context._metrics->AddLatency(System::Timestamp() - timestamp);
+                    // Update running timestamps of the producer
+                    int64_t stop = System::Timestamp();
+                    producer_context._metrics->SetRunning(start, stop);
+                    running[i] = std::make_tuple(start, stop, producer_context._metrics->total_operations());
 
-                            // Decrement operation counters
-                            producer_operations -= 1;
-                        }
-                        producer_context._current->StopCollectingMetrics();
+                    // Wait for other threads at the stop barrier
+                    barrier.Wait();
 
-                        // Call cleanup producer method...
-                        CleanupProducer(producer_context);
+                    // Call cleanup producer method...
+                    CleanupProducer(producer_context);
 
-                        // Update thread safe phase metrics
-                        UpdateBenchmarkMetrics(*producer_context._current);
-                    });
-                }
+                    // Update thread safe phase metrics
+                    UpdateBenchmarkMetrics(*producer_context._current);
+                };
 
-                // Start benchmark consumers
-                for (int i = 0; i < consumers; ++i)
+                // Prepare benchmark consumer task
+                auto consumer = [this, &barrier, &running, &context, latency_params, producers, consumers](int i, int cpu)
                 {
-                    _threads.emplace_back([this, &barrier, &context, latency_params, latency_auto, consumers, i]()
-                    {
-                        // Clone consumer context
-                        ContextPC consumer_context(context);
+                    // Clone consumer context
+                    ContextPC consumer_context(context);
 
-                        // Create and start thread safe phase
-                        std::shared_ptr<Phase> consumer_phase = context.StartPhaseThreadSafe("consumer-" + std::to_string(i));
-                        PhaseCore* consumer_phase_core = dynamic_cast<PhaseCore*>(consumer_phase.get());
+                    // Create and start thread safe phase
+                    std::shared_ptr<Phase> consumer_phase = context.StartPhaseThreadSafe("consumer-" + std::to_string(i));
+                    PhaseCore* consumer_phase_core = dynamic_cast<PhaseCore*>(consumer_phase.get());
 
-                        // Update consumer context
-                        consumer_context._current = consumer_phase_core;
-                        consumer_context._metrics = &consumer_phase_core->current();
-                        consumer_context._metrics->AddOperations(-1);
-                        consumer_context._metrics->SetThreads(consumers);
+                    // Update consumer context
+                    consumer_context._current = consumer_phase_core;
+                    consumer_context._metrics = &consumer_phase_core->current();
+                    consumer_context._metrics->AddOperations(-1);
+                    consumer_context._metrics->SetThreads(consumers);
+                    consumer_context._metrics->SetCpu(cpu);
 
-                        // Initialize latency histogram of the current phase
-                        consumer_context._current->InitLatencyHistogram(latency_params);
+                    // Initialize latency histogram of the current phase
+                    consumer_context._current->InitLatencyHistogram(latency_params, _settings.latency_attempts());
 
-                        // Call initialize consumer method...
-                        InitializeConsumer(consumer_context);
+                    // Call initialize consumer method...
+                    InitializeConsumer(consumer_context);
 
-                        // Wait for other threads at the barrier
-                        barrier.Wait();
+                    // Prepare consumer operations...
+                    auto run = [this, &consumer_context]() { RunConsumer(consumer_context); };
+                    auto stopped = [&consumer_context]() { return consumer_context.consume_stopped() || consumer_context.canceled(); };
+                    int64_t batch = PrepareOperations(consumer_context, true, 0, 0, false, false, run, stopped);
 
-                        consumer_context._current->StartCollectingMetrics();
-                        while (!consumer_context.consume_stopped() && !consumer_context.canceled())
-                        {
-                            // Add new metrics operation
-                            consumer_context._metrics->AddOperations(1);
+                    // Wait for other threads at the start barrier
+                    barrier.Wait();
+                    int64_t start = System::Timestamp();
 
-                            // Store timestamp for automatic latency update
-                            uint64_t timestamp = 0;
-                            if (latency_auto)
-                                timestamp = System::Timestamp();
+                    // Run consumer operations...
+                    MeasureOperations(consumer_context, true, 0, 0, batch, false, run, stopped);
 
-                            // Run consumer method...
-                            RunConsumer(consumer_context);
+                    // Update running timestamps of the consumer
+                    int64_t stop = System::Timestamp();
+                    consumer_context._metrics->SetRunning(start, stop);
+                    running[producers + i] = std::make_tuple(start, stop, consumer_context._metrics->total_operations());
 
-                            // Automatic latency update
-                            if (latency_auto)
-                                consumer_context._metrics->AddLatency(System::Timestamp() - timestamp);
-                        }
-                        consumer_context._current->StopCollectingMetrics();
+                    // Wait for other threads at the stop barrier
+                    barrier.Wait();
 
-                        // Call cleanup consumer method...
-                        CleanupConsumer(consumer_context);
+                    // Call cleanup consumer method...
+                    CleanupConsumer(consumer_context);
 
-                        // Update thread safe phase metrics
-                        UpdateBenchmarkMetrics(*consumer_context._current);
-                    });
-                }
+                    // Update thread safe phase metrics
+                    UpdateBenchmarkMetrics(*consumer_context._current);
+                };
 
-                // Wait for all threads
-                for (auto& thread : _threads)
-                    thread.join();
-
-                // Clear threads collection
-                _threads.clear();
+                // Run benchmark producers & consumers on the worker threads pool and wait for all of them
+                ThreadPool::Default().Run(placement, [&producer, &consumer, producers](int index, int cpu)
+                {
+                    if (index < producers)
+                        producer(index, cpu);
+                    else
+                        consumer(index - producers, cpu);
+                });
 
                 // Stop benchmark root phase operation
                 context._current->StopCollectingMetrics();
 
+                // Update start skew and overlap window of producers & consumers threads
+                UpdateBenchmarkOverlap(*context._metrics, running, _settings.overlap());
+
                 // Call cleanup benchmark methods...
                 Cleanup(context);
 
@@ -227,11 +212,43 @@ void BenchmarkPC::Launch(int& current, int total, LauncherHandler& handler)
                 context._current->ResetMetrics();
             }
         }
+
+        // Stop making attempts when benchmark results converge
+        if (IsBenchmarkConverged(_phases, _settings, attempt, true))
+            break;
     }
 
     // Update benchmark threads
     UpdateBenchmarkThreads(_phases);
 
+    // Update benchmark statistics before combining metrics of the selected attempts of all threads
+    UpdateBenchmarkStatistics(_phases, _settings);
+
+    // Update benchmark latency combined over all producers and consumers
+    UpdateBenchmarkLatency(_phases, "producer-");
+    UpdateBenchmarkLatency(_phases, "consumer-");
+
+    // Update benchmark interval snapshots combined over all producers and consumers
+    UpdateBenchmarkIntervals(_phases, "producer-");
+    UpdateBenchmarkIntervals(_phases, "consumer-");
+
+    // Update benchmark samples combined over all producers and consumers
+    UpdateBenchmarkSamples(_phases, "producer-");
+    UpdateBenchmarkSamples(_phases, "consumer-");
+
+    // Update benchmark producers and consumers fairness
+    UpdateBenchmarkFairness(_phases, "producer-");
+    UpdateBenchmarkFairness(_phases, "consumer-");
+
+    // Update benchmark counters
+    UpdateBenchmarkCounters(_phases);
+
+    // Update benchmark resources usage
+    UpdateBenchmarkResources(_phases);
+
+    // Update benchmark heap allocations
+    UpdateBenchmarkAllocations(_phases);
+
     // Update benchmark names
     UpdateBenchmarkNames(_phases);
 
@@ -11,6 +11,7 @@
 #include "benchmark/barrier.h"
 #include "benchmark/launcher_handler.h"
 #include "benchmark/system.h"
+#include "benchmark/thread_pool.h"
 
 namespace CppBenchmark {
 
@@ -19,11 +20,22 @@ int BenchmarkThreads::CountLaunches() const
     return _settings.attempts() * (_settings.threads().empty() ? 1 : (int)_settings.threads().size()) * (_settings.params().empty() ? 1 : (int)_settings.params().size());
 }
 
-void BenchmarkThreads::Launch(int& current, int total, LauncherHandler& handler)
+void BenchmarkThreads::Launch(int& current, int& total, ClockType clock, LauncherHandler& handler)
 {
+    _clock = clock;
+
+    // Prepare CPU topology for threads placement
+    std::vector<CpuTopology> topology;
+    if (_settings.affinity() != AffinityPolicy::None)
+        topology = System::CpuTopologies();
+
     // Make several attempts of execution...
-    for (int attempt = 1; attempt <= _settings.attempts(); ++attempt)
+    for (int attempt = 1; attempt <= _settings.attempts_max(); ++attempt)
     {
+        // Extend the estimated launches count for the extra attempt
+        if (attempt > _settings.attempts())
+            total += CountLaunches() / _settings.attempts();
+
         // Run benchmark at least for N threads where N is hardware core count
         if (_settings._threads.empty())
             _settings._threads.emplace_back(System::CpuPhysicalCores());
@@ -46,7 +58,6 @@ void BenchmarkThreads::Launch(int& current, int total, LauncherHandler& handler)
 
                 // Prepare latency histogram parameters
                 std::tuple<int64_t, int64_t, int> latency_params(_settings.latency());
-                bool latency_auto = _settings.latency_auto();
 
                 // Call launching notification...
                 handler.onLaunching(++current, total, *this, context, attempt);
@@ -58,107 +69,76 @@ void BenchmarkThreads::Launch(int& current, int total, LauncherHandler& handler)
                 int64_t duration = _settings.duration();
                 int64_t operations = _settings.operations();
 
-                // Prepare barrier for benchmark threads
+                // Plan logical CPUs for benchmark threads
+                std::vector<int> placement = Affinity::PlanThreads(_settings.affinity(), topology, _settings.affinity_cpus(), threads);
+
+                // Prepare barrier and running timestamps for benchmark threads
                 Barrier barrier(threads);
+                std::vector<std::tuple<int64_t, int64_t, int64_t>> running(threads);
+
+                // Create and bind worker threads before the root phase is measured
+                ThreadPool::Default().Warmup(placement);
 
                 // Start benchmark root phase operation
                 context._current->StartCollectingMetrics();
                 context._metrics->AddOperations(1);
 
-                // Start benchmark threads
-                for (int i = 0; i < threads; ++i)
+                // Run benchmark threads on the worker threads pool and wait for all of them
+                ThreadPool::Default().Run(placement, [this, &barrier, &running, &context, latency_params, threads, infinite, operations, duration](int i, int cpu)
                 {
-                    _threads.emplace_back([this, &barrier, &context, latency_params, latency_auto, threads, infinite, operations, duration, i]()
-                    {
-                        // Clone thread context
-                        ContextThreads thread_context(context);
-
-                        // Create and start thread safe phase
-                        std::shared_ptr<Phase> thread_phase = context.StartPhaseThreadSafe("thread-" + std::to_string(i));
-                        PhaseCore* thread_phase_core = dynamic_cast<PhaseCore*>(thread_phase.get());
-
-                        // Update thread context
-                        thread_context._current = thread_phase_core;
-                        thread_context._metrics = &thread_phase_core->current();
-                        thread_context._metrics->AddOperations(-1);
-                        thread_context._metrics->SetThreads(threads);
-
-                        // Initialize latency histogram of the current phase
-                        thread_context._current->InitLatencyHistogram(latency_params);
+                    // Clone thread context
+                    ContextThreads thread_context(context);
 
-                        // Call initialize thread method...
-                        InitializeThread(thread_context);
+                    // Create and start thread safe phase
+                    std::shared_ptr<Phase> thread_phase = context.StartPhaseThreadSafe("thread-" + std::to_string(i));
+                    PhaseCore* thread_phase_core = dynamic_cast<PhaseCore*>(thread_phase.get());
 
-                        bool thread_infinite = infinite;
-                        int64_t thread_duration = duration;
-                        int64_t thread_operations = operations;
+                    // Update thread context
+                    thread_context._current = thread_phase_core;
+                    thread_context._metrics = &thread_phase_core->current();
+                    thread_context._metrics->AddOperations(-1);
+                    thread_context._metrics->SetThreads(threads);
+                    thread_context._metrics->SetCpu(cpu);
 
-                        uint64_t timestamp = 0;
+                    // Initialize latency histogram of the current phase
+                    thread_context._current->InitLatencyHistogram(latency_params, _settings.latency_attempts());
 
-                        // Wait for other threads at the barrier
-                        barrier.Wait();
+                    // Call initialize thread method...
+                    InitializeThread(thread_context);
 
-                        // Calculate the approximate count of operations which can be performed for the given duration
-                        if (thread_duration > 0)
-                        {
-                            uint64_t count = 0;
-                            uint64_t timespan = 0;
+                    // Prepare thread operations...
+                    auto run = [this, &thread_context]() { RunThread(thread_context); };
+                    auto stopped = [&thread_context]() { return thread_context.canceled(); };
+                    int64_t batch = PrepareOperations(thread_context, infinite, duration, operations, _settings.batched(), true, run, stopped);
 
-                            // Collect data for one second...
-                            for (; timespan < 1000000000; ++count)
-                            {
-                                timestamp = System::Timestamp();
+                    // Wait for other threads at the start barrier
+                    barrier.Wait();
+                    int64_t start = System::Timestamp();
 
-                                // Run thread method...
-                                RunThread(thread_context);
+                    // Run thread operations...
+                    MeasureOperations(thread_context, infinite, duration, operations, batch, true, run, stopped);
 
-                                timespan += System::Timestamp() - timestamp;
-                            }
+                    // Update running timestamps of the thread
+                    int64_t stop = System::Timestamp();
+                    thread_context._metrics->SetRunning(start, stop);
+                    running[i] = std::make_tuple(start, stop, thread_context._metrics->total_operations());
 
-                            // Approximate operations count
-                            thread_operations = (1000000000ull * count * thread_duration) / timespan;
-                        }
+                    // Wait for other threads at the stop barrier
+                    barrier.Wait();
 
-                        thread_context._current->StartCollectingMetrics();
-                        while (!thread_context.canceled() && (thread_infinite || (thread_operations > 0)))
-                        {
-                            // Add new metrics operation
-                            thread_context._metrics->AddOperations(1);
+                    // Call cleanup thread method...
+                    CleanupThread(thread_context);
 
-                            // Store the timestamp for the automatic latency update
-                            if (latency_auto)
-                                timestamp = System::Timestamp();
-
-                            // Run thread method...
-                            RunThread(thread_context);
-
-                            // Update latency metrics
-                            if (latency_auto)
-                                thread_context._metrics->AddLatency(System::Timestamp() - timestamp);
-
-                            // Decrement operation counters
-                            thread_operations -= 1;
-                        }
-                        thread_context._current->StopCollectingMetrics();
-
-                        // Call cleanup thread method...
-                        CleanupThread(thread_context);
-
-                        // Update thread safe phase metrics
-                        UpdateBenchmarkMetrics(*thread_context._current);
-                    });
-                }
-
-                // Wait for all threads
-                for (auto& thread : _threads)
-                    thread.join();
-
-                // Clear threads collection
-                _threads.clear();
+                    // Update thread safe phase metrics
+                    UpdateBenchmarkMetrics(*thread_context._current);
+                });
 
                 // Stop benchmark root phase operation
                 context._current->StopCollectingMetrics();
 
+                // Update start skew and overlap window of benchmark threads
+                UpdateBenchmarkOverlap(*context._metrics, running, _settings.overlap());
+
                 // Call cleanup benchmark method...
                 Cleanup(context);
 
@@ -170,17 +150,45 @@ void BenchmarkThreads::Launch(int& current, int total, LauncherHandler& handler)
                 context._current->ResetMetrics();
             }
         }
+
+        // Stop making attempts when benchmark results converge
+        if (IsBenchmarkConverged(_phases, _settings, attempt, true))
+            break;
     }
 
     // Update benchmark threads
     UpdateBenchmarkThreads(_phases);
 
-    // Update benchmark names
-    UpdateBenchmarkNames(_phases);
-
     // Update benchmark operations
     UpdateBenchmarkOperations(_phases);
 
+    // Update benchmark statistics before combining metrics of the selected attempts of all threads
+    UpdateBenchmarkStatistics(_phases, _settings);
+
+    // Update benchmark latency combined over all threads
+    UpdateBenchmarkLatency(_phases, "thread-");
+
+    // Update benchmark interval snapshots combined over all threads
+    UpdateBenchmarkIntervals(_phases, "thread-");
+
+    // Update benchmark samples combined over all threads
+    UpdateBenchmarkSamples(_phases, "thread-");
+
+    // Update benchmark threads fairness
+    UpdateBenchmarkFairness(_phases, "thread-");
+
+    // Update benchmark counters
+    UpdateBenchmarkCounters(_phases);
+
+    // Update benchmark resources usage
+    UpdateBenchmarkResources(_phases);
+
+    // Update benchmark heap allocations
+    UpdateBenchmarkAllocations(_phases);
+
+    // Update benchmark names
+    UpdateBenchmarkNames(_phases);
+
     // Update benchmark launched flag
     _launched = true;
 }
@@ -0,0 +1,188 @@
+/*!
+    \file counters.cpp
+    \brief Hardware performance counters implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/counters.h"
+
+#include "benchmark/system.h"
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace CppBenchmark {
+
+Counters::Counters()
+    : _mask(0),
+      _thread(System::CurrentThreadId()),
+      _hardware(-1),
+      _software(-1),
+      _hardware_count(0),
+      _software_count(0)
+{
+    _fds.fill(-1);
+
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    static const CounterType hardware[] = { CounterType::Cycles, CounterType::Instructions, CounterType::BranchMisses, CounterType::L1DMisses, CounterType::LLCMisses, CounterType::DTLBMisses };
+    static const CounterType software[] = { CounterType::TaskClock, CounterType::PageFaults };
+
+    // Open hardware events group (skip events which cannot be opened)
+    for (auto type : hardware)
+    {
+        int fd = Open(type, _hardware);
+        if (fd >= 0)
+        {
+            if (_hardware < 0)
+                _hardware = fd;
+            _fds[(int)type] = fd;
+            _hardware_types[_hardware_count++] = type;
+            _mask |= (1u << (int)type);
+        }
+    }
+
+    // Open software events group
+    for (auto type : software)
+    {
+        int fd = Open(type, _software);
+        if (fd >= 0)
+        {
+            if (_software < 0)
+                _software = fd;
+            _fds[(int)type] = fd;
+            _software_types[_software_count++] = type;
+            _mask |= (1u << (int)type);
+        }
+    }
+#endif
+}
+
+Counters::~Counters()
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    for (auto fd : _fds)
+        if (fd >= 0)
+            close(fd);
+#endif
+}
+
+void Counters::Read(Values& values) const noexcept
+{
+    if (_hardware >= 0)
+        ReadGroup(_hardware, _hardware_types, _hardware_count, values);
+    if (_software >= 0)
+        ReadGroup(_software, _software_types, _software_count, values);
+}
+
+const char* Counters::Name(CounterType type) noexcept
+{
+    switch (type)
+    {
+        case CounterType::Cycles:
+            return "cycles";
+        case CounterType::Instructions:
+            return "instructions";
+        case CounterType::BranchMisses:
+            return "branch_misses";
+        case CounterType::L1DMisses:
+            return "l1d_misses";
+        case CounterType::LLCMisses:
+            return "llc_misses";
+        case CounterType::DTLBMisses:
+            return "dtlb_misses";
+        case CounterType::TaskClock:
+            return "task_clock";
+        case CounterType::PageFaults:
+            return "page_faults";
+        default:
+            return "<unknown>";
+    }
+}
+
+int Counters::Open(CounterType type, int group) noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+
+    switch (type)
+    {
+        case CounterType::Cycles:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case CounterType::Instructions:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case CounterType::BranchMisses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case CounterType::L1DMisses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case CounterType::LLCMisses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case CounterType::DTLBMisses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case CounterType::TaskClock:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_TASK_CLOCK;
+            break;
+        case CounterType::PageFaults:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+            break;
+        default:
+            return -1;
+    }
+
+    // Count only user space events of the current thread on any CPU
+    attr.disabled = 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, PERF_FLAG_FD_CLOEXEC);
+#else
+    return -1;
+#endif
+}
+
+void Counters::ReadGroup(int fd, const std::array<CounterType, COUNT>& types, int count, Values& values) noexcept
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    // Group read format: count of events, time enabled, time running, events values
+    uint64_t data[3 + COUNT];
+    if (read(fd, data, sizeof(data)) < (ssize_t)(3 * sizeof(uint64_t)))
+        return;
+
+    uint64_t events = data[0];
+    uint64_t enabled = data[1];
+    uint64_t running = data[2];
+
+    // Group was not scheduled on the PMU yet
+    if (running == 0)
+        return;
+
+    // Scale values multiplexed with other events
+    double scale = (double)enabled / (double)running;
+    for (int i = 0; (i < count) && (i < (int)events); ++i)
+        values[(int)types[i]] = (int64_t)((double)data[3 + i] * scale);
+#endif
+}
+
+} // namespace CppBenchmark
@@ -9,6 +9,7 @@
 #include "benchmark/executor.h"
 
 #include <algorithm>
+#include <chrono>
 
 namespace CppBenchmark {
 
@@ -44,65 +45,265 @@ public:
 } // namespace Internals
 //! @endcond
 
-std::shared_ptr<Phase> Executor::StartBenchmark(const std::string& benchmark)
+std::shared_ptr<Phase> Executor::StartBenchmark(std::string_view benchmark, uint64_t hash)
+{
+    std::shared_ptr<PhaseCore> result = FindBenchmark(benchmark, hash);
+
+    // Start new operation for the dynamic benchmark
+    PhaseHandle(nullptr, result.get()).Start();
+
+    return result;
+}
+
+void Executor::StopBenchmark(std::string_view benchmark, uint64_t hash)
+{
+    Registry& registry = GetRegistry();
+
+    // Find dynamic benchmark with the given name probing keys of colliding name hashes
+    auto it = registry.index.find(hash);
+    while ((it != registry.index.end()) && (it->second->name() != benchmark))
+        it = registry.index.find(++hash);
+    if (it != registry.index.end())
+        it->second->StopOperation();
+}
+
+void Executor::StopBenchmark(uint64_t hash)
+{
+    Registry& registry = GetRegistry();
+
+    // Find dynamic benchmark with the given name hash
+    auto it = registry.index.find(hash);
+    if (it != registry.index.end())
+        it->second->StopOperation();
+}
+
+void Executor::SetSampling(const Sampling& sampling)
 {
     Executor& instance = GetInstance();
 
-    std::shared_ptr<PhaseCore> result;
+    std::scoped_lock lock(instance._mutex);
+
+    instance._sampling = sampling;
+}
+
+void Executor::SetSampling(const std::string& benchmark, const Sampling& sampling)
+{
+    Executor& instance = GetInstance();
+
+    std::scoped_lock lock(instance._mutex);
+
+    instance._samplings[Hash(benchmark)] = sampling;
+}
+
+bool Executor::Export(const std::string& path, uint32_t capacity)
+{
+    Executor& instance = GetInstance();
+
+    std::scoped_lock lock(instance._mutex);
+
+    // Exported phases refer to the region, so it is created only once
+    if (instance._export)
+        return false;
+
+    auto metrics = std::make_unique<MetricsExport>();
+    if (!metrics->Create(path, std::max(capacity, (uint32_t)1)))
+        return false;
+
+    instance._export = std::move(metrics);
+    return true;
+}
+
+void Executor::Report(Reporter& reporter)
+{
+    Executor& instance = GetInstance();
+
+    // Registry of the current thread (if any) is updated directly
+    Registry* current = CurrentRegistry(false);
 
-    // Update dynamic benchmarks collection under lock guard...
+    std::scoped_lock lock(instance._mutex);
+
+    // Collect dynamic benchmarks of all threads
+    std::vector<std::pair<uint64_t, std::shared_ptr<PhaseCore>>> registered;
+    for (auto it = instance._registries.begin(); it != instance._registries.end();)
     {
-        std::scoped_lock lock(instance._mutex);
+        Registry& registry = **it;
+
+        // Metrics of finished threads and the current thread are not updated concurrently
+        bool finished = registry.finished.load(std::memory_order_acquire);
+        bool owned = (&registry == current) || finished;
 
-        // Find or create a dynamic benchmark with the given name
-        auto it = std::find_if(instance._benchmarks.begin(), instance._benchmarks.end(), [&benchmark](const std::shared_ptr<PhaseCore>& item)
         {
-            return ((item->name() == benchmark) && (item->_thread == System::CurrentThreadId()));
-        });
-        if (it == instance._benchmarks.end())
+            std::scoped_lock registry_lock(registry.mutex);
+
+            for (const auto& benchmark : registry.benchmarks)
+            {
+                // Metrics are published into windows while background reporting is active
+                if (!instance._windows)
+                {
+                    if (owned)
+                        BenchmarkBase::UpdateBenchmarkMetrics(*benchmark.second);
+
+                    // Merge metrics published by the owner thread
+                    std::shared_ptr<PhaseCore> snapshot = TakeSnapshot(*benchmark.second);
+                    if (snapshot)
+                        MergeSnapshot(*benchmark.second, *snapshot);
+                }
+
+                if (!finished || instance._windows)
+                    registered.emplace_back(benchmark);
+            }
+        }
+
+        // Drop the registry of the finished thread keeping its results
+        if (finished && !instance._windows)
         {
-            result = std::make_shared<PhaseCore>(benchmark);
-            instance._benchmarks.emplace_back(result);
+            instance.RetireRegistry(registry);
+            it = instance._registries.erase(it);
         }
         else
-            result = *it;
+            ++it;
     }
 
-    // Start new operation for the child dynamic benchmark
-    result->StartCollectingMetrics();
+    // Report results of finished threads
+    registered.insert(registered.end(), instance._retired.begin(), instance._retired.end());
 
-    // Add new metrics operation
-    result->_metrics_current.AddOperations(1);
+    // Request live threads to publish their metrics for the next report
+    if (!instance._windows)
+        instance._window.fetch_add(1, std::memory_order_release);
 
-    return result;
+    instance.ReportBenchmarks(reporter, registered);
 }
 
-void Executor::StopBenchmark(const std::string& benchmark)
+void Executor::StartReporting(const std::shared_ptr<Reporter>& reporter, int64_t interval)
 {
     Executor& instance = GetInstance();
 
-    // Update dynamic benchmarks collection under lock guard...
+    std::scoped_lock lock(instance._reporting_control);
+
+    // Restart the reporting thread
+    instance.StopReportingThread();
+    instance._reporting_stop = false;
+
+    // Request the first window
     {
-        std::scoped_lock lock(instance._mutex);
+        std::scoped_lock windows_lock(instance._mutex);
+        instance._windows = true;
+        instance._window.fetch_add(1, std::memory_order_release);
+    }
+
+    instance._reporting = std::thread([&instance, reporter, interval]() { instance.Reporting(reporter, std::max(interval, (int64_t)1)); });
+}
 
-        // Find dynamic benchmark with the given name
-        auto it = std::find_if(instance._benchmarks.begin(), instance._benchmarks.end(), [&benchmark](const std::shared_ptr<PhaseCore>& item)
+void Executor::StopReporting()
+{
+    Executor& instance = GetInstance();
+
+    std::scoped_lock lock(instance._reporting_control);
+
+    instance.StopReportingThread();
+}
+
+void Executor::StopReportingThread()
+{
+    {
+        std::scoped_lock lock(_reporting_mutex);
+        _reporting_stop = true;
+    }
+    _reporting_cv.notify_all();
+
+    if (_reporting.joinable())
+        _reporting.join();
+
+    std::scoped_lock lock(_mutex);
+    _windows = false;
+}
+
+void Executor::Reporting(std::shared_ptr<Reporter> reporter, int64_t interval)
+{
+    std::unique_lock lock(_reporting_mutex);
+
+    bool stop = false;
+    while (!stop)
+    {
+        stop = _reporting_cv.wait_for(lock, std::chrono::milliseconds(interval), [this]() { return _reporting_stop; });
+
+        // Report the window without the lock to allow stopping. The last window does not request the next one.
+        lock.unlock();
+        ReportWindow(*reporter, !stop);
+        lock.lock();
+    }
+}
+
+void Executor::ReportWindow(Reporter& reporter, bool next)
+{
+    // Take published window snapshots of dynamic benchmarks of all threads
+    std::vector<std::pair<uint64_t, std::shared_ptr<PhaseCore>>> registered;
+    {
+        std::scoped_lock lock(_mutex);
+
+        for (auto it = _registries.begin(); it != _registries.end();)
         {
-            return ((item->name() == benchmark) && (item->_thread == System::CurrentThreadId()));
-        });
-        if (it != instance._benchmarks.end())
-            (*it)->StopCollectingMetrics();
+            Registry& registry = **it;
+
+            // Publish windows of finished threads on their behalf
+            bool finished = registry.finished.load(std::memory_order_acquire);
+            bool retire = finished;
+
+            {
+                std::scoped_lock registry_lock(registry.mutex);
+
+                for (const auto& benchmark : registry.benchmarks)
+                {
+                    std::shared_ptr<PhaseCore> snapshot = TakeSnapshot(*benchmark.second);
+
+                    // Current metrics of the finished thread are published after its previous snapshot is taken
+                    if (finished)
+                    {
+                        if (snapshot)
+                            retire = false;
+                        else
+                            snapshot = benchmark.second->SnapshotMetrics();
+                    }
+
+                    if (snapshot)
+                        registered.emplace_back(benchmark.first, snapshot);
+                }
+            }
+
+            // Drop the registry of the finished thread after its last window
+            if (retire)
+            {
+                RetireRegistry(registry);
+                it = _registries.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        // Request the next window
+        if (next)
+            _window.fetch_add(1, std::memory_order_release);
     }
+
+    ReportBenchmarks(reporter, registered);
 }
 
-void Executor::Report(Reporter& reporter)
+void Executor::ReportBenchmarks(Reporter& reporter, std::vector<std::pair<uint64_t, std::shared_ptr<PhaseCore>>>& registered) const
 {
-    Executor& instance = GetInstance();
+    // Sort dynamic benchmarks in the registration order
+    std::sort(registered.begin(), registered.end(), [](const auto& item1, const auto& item2) { return item1.first < item2.first; });
 
-    std::scoped_lock lock(instance._mutex);
+    // Aggregate dynamic benchmarks with a same name of all threads
+    std::vector<std::shared_ptr<PhaseCore>> benchmarks;
+    for (const auto& item : registered)
+    {
+        const auto& benchmark = item.second;
 
-    BenchmarkBase::UpdateBenchmarkMetrics(instance._benchmarks);
-    BenchmarkBase::UpdateBenchmarkThreads(instance._benchmarks);
+        auto it = std::find_if(benchmarks.begin(), benchmarks.end(), [&benchmark](const std::shared_ptr<PhaseCore>& phase) { return phase->name() == benchmark->name(); });
+        if (it == benchmarks.end())
+            it = benchmarks.emplace(benchmarks.end(), std::make_shared<PhaseCore>(benchmark->name()));
+        MergeBenchmark(**it, *benchmark);
+    }
 
     // Report header, system & environment
     reporter.ReportHeader();
@@ -111,7 +312,7 @@ void Executor::Report(Reporter& reporter)
     reporter.ReportBenchmarksHeader();
 
     // For all registered benchmarks...
-    for (const auto& benchmark : instance._benchmarks)
+    for (const auto& benchmark : benchmarks)
     {
         // Create dynamic benchmark wrapper
         Internals::DynamicBenchmark result(benchmark->name(), Settings().Attempts(1));
@@ -120,7 +321,7 @@ void Executor::Report(Reporter& reporter)
         reporter.ReportBenchmarkHeader();
         reporter.ReportBenchmark(result, result.settings());
         reporter.ReportPhasesHeader();
-        instance.ReportPhase(reporter, *benchmark, benchmark->name());
+        ReportPhase(reporter, *benchmark, benchmark->name());
         reporter.ReportPhasesFooter();
         reporter.ReportBenchmarkFooter();
     }
@@ -142,4 +343,133 @@ void Executor::ReportPhase(Reporter& reporter, const PhaseCore& phase, const std
     }
 }
 
+Executor::Registry* Executor::CurrentRegistry(bool create)
+{
+    //! Registry of the current thread which is marked as finished on the thread exit
+    struct ThreadRegistry
+    {
+        Registry* registry = nullptr;
+        ~ThreadRegistry() { if (registry != nullptr) registry->finished.store(true, std::memory_order_release); }
+    };
+
+    thread_local ThreadRegistry thread;
+
+    // Register a new registry of the current thread once. The registry is owned by the executor
+    // to keep dynamic benchmarks of finished threads until the report.
+    if ((thread.registry == nullptr) && create)
+    {
+        Executor& instance = GetInstance();
+
+        std::scoped_lock lock(instance._mutex);
+
+        auto result = std::make_shared<Registry>();
+        instance._registries.emplace_back(result);
+        thread.registry = result.get();
+    }
+
+    return thread.registry;
+}
+
+const std::shared_ptr<PhaseCore>& Executor::FindBenchmark(std::string_view benchmark, uint64_t hash)
+{
+    Registry& registry = GetRegistry();
+
+    // Find dynamic benchmark with the given name probing keys of colliding name hashes
+    uint64_t key = hash;
+    auto it = registry.index.find(key);
+    while ((it != registry.index.end()) && (it->second->name() != benchmark))
+        it = registry.index.find(++key);
+
+    // Create a new dynamic benchmark
+    if (it == registry.index.end())
+    {
+        auto result = std::make_shared<PhaseCore>(std::string(benchmark));
+
+        // Setup sampling policy of the dynamic benchmark
+        {
+            Executor& instance = GetInstance();
+
+            std::scoped_lock lock(instance._mutex);
+
+            auto sampling = instance._samplings.find(hash);
+            result->SetSampling((sampling != instance._samplings.end()) ? sampling->second : instance._sampling);
+
+            // Export live metrics of the dynamic benchmark
+            if (instance._export)
+                result->SetExport(instance._export.get(), result->name());
+
+            // Start metrics windows from the current one
+            result->_window = &instance._window;
+            result->_window_published = instance._window.load(std::memory_order_acquire);
+        }
+
+        // Update the registry under lock guard to synchronize with the report...
+        std::scoped_lock lock(registry.mutex);
+        registry.benchmarks.emplace_back(GetInstance()._order++, result);
+        it = registry.index.emplace(key, result).first;
+    }
+
+    return it->second;
+}
+
+std::shared_ptr<PhaseCore> Executor::TakeSnapshot(PhaseCore& benchmark)
+{
+    std::shared_ptr<PhaseCore> result;
+
+    std::scoped_lock lock(benchmark._mutex);
+    result.swap(benchmark._window_snapshot);
+    return result;
+}
+
+void Executor::RetireRegistry(Registry& registry)
+{
+    for (const auto& benchmark : registry.benchmarks)
+    {
+        // Skip dynamic benchmarks without reported results
+        if (benchmark.second->metrics().attempts().empty())
+            continue;
+
+        // Aggregate results of finished threads with a same name
+        auto it = std::find_if(_retired.begin(), _retired.end(), [&benchmark](const auto& item) { return item.second->name() == benchmark.second->name(); });
+        if (it == _retired.end())
+            it = _retired.emplace(_retired.end(), benchmark.first, std::make_shared<PhaseCore>(benchmark.second->name()));
+        MergeBenchmark(*it->second, *benchmark.second);
+    }
+}
+
+void Executor::MergeSnapshot(PhaseCore& phase, PhaseCore& snapshot)
+{
+    // Skip snapshot without operations to keep metrics of the previous one
+    if (snapshot.metrics().total_operations() > 0)
+        phase.MergeMetrics(snapshot);
+
+    // Snapshot child phases have the same order as child phases of the live phase
+    for (size_t i = 0; i < snapshot._child.size(); ++i)
+    {
+        std::shared_ptr<PhaseCore> child;
+        {
+            std::scoped_lock lock(phase._mutex);
+            if (i < phase._child.size())
+                child = phase._child[i];
+        }
+        if (child)
+            MergeSnapshot(*child, *snapshot._child[i]);
+    }
+}
+
+void Executor::MergeBenchmark(PhaseCore& result, PhaseCore& phase)
+{
+    // Merge metrics results
+    result.MergeMetrics(phase);
+
+    // Merge child phases with a same name
+    for (const auto& child : phase._child)
+    {
+        auto it = std::find_if(result._child.begin(), result._child.end(), [&child](const std::shared_ptr<PhaseCore>& item) { return item->name() == child->name(); });
+        if (it == result._child.end())
+            it = result._child.emplace(result._child.end(), std::make_shared<PhaseCore>(child->name()));
+        MergeBenchmark(**it, *child);
+    }
+}
+
 } // namespace CppBenchmark
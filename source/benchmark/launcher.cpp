@@ -8,11 +8,74 @@
 
 #include "benchmark/launcher.h"
 
+#include "benchmark/affinity.h"
+#include "benchmark/thread_pool.h"
+
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
 #include <regex>
 
+#include <hdr/hdr_histogram.h>
+#include <hdr/hdr_histogram_log.h>
+
 namespace CppBenchmark {
 
+//! @cond INTERNALS
+namespace Internals {
+
+//! Launcher handler of the parallel job
+/*!
+    Counts launches of the job and forwards each finished launch to the launcher with the extension
+    of the estimated launches count made by extra attempts of the job benchmark.
+*/
+class JobHandler : public LauncherHandler
+{
+public:
+    typedef std::function<void (int, const BenchmarkBase&, const Context&, int)> Notify;
+
+    //! Current launch number of the job
+    int current;
+    //! Estimated launches count extension of the job
+    int total;
+
+    explicit JobHandler(const Notify& notify) : current(0), total(0), _notify(notify), _notified(0) {}
+
+protected:
+    void onLaunched(int launch, int launches, const BenchmarkBase& benchmark, const Context& context, int attempt) override
+    {
+        _notify(launches - _notified, benchmark, context, attempt);
+        _notified = launches;
+    }
+
+private:
+    Notify _notify;
+    int _notified;
+};
+
+//! Validate the report filename
+/*!
+    Replaces path separators, spaces and characters deprecated in filenames with underscores,
+    so each phase is reported into its own file in the current directory.
+*/
+std::string ValidateFilename(const std::string& name)
+{
+    const std::string deprecated = "\\/?%*:|\"<> ";
+
+    std::string filename(name);
+    for (auto& ch : filename)
+        if (deprecated.find(ch) != std::string::npos)
+            ch = '_';
+    return filename;
+}
+
+} // namespace Internals
+//! @endcond
+
 void Launcher::Launch(const std::string& pattern)
 {
     int current = 0;
@@ -35,9 +98,81 @@ void Launcher::Launch(const std::string& pattern)
         }
     }
 
-    // Launch filtered benchmarks
+    // Split filtered benchmarks into parallel and sequential ones
+    std::vector<std::shared_ptr<BenchmarkBase>> parallel;
+    std::vector<std::shared_ptr<BenchmarkBase>> sequential;
     for (const auto& benchmark : benchmarks)
-        benchmark->Launch(current, total, *this);
+    {
+        // Single-threaded benchmarks are launched with parallel jobs
+        if ((_jobs > 1) && (dynamic_cast<Benchmark*>(benchmark.get()) != nullptr))
+            parallel.push_back(benchmark);
+        else
+            sequential.push_back(benchmark);
+    }
+
+    // Launch single-threaded benchmarks with parallel jobs
+    if (!parallel.empty())
+        LaunchJobs(parallel, current, total);
+
+    // Launch other benchmarks one by one
+    for (const auto& benchmark : sequential)
+        benchmark->Launch(current, total, ResolveClock(benchmark->settings()), *this);
+}
+
+ClockType Launcher::ResolveClock(const Settings& settings) const
+{
+    ClockType clock = settings.clock();
+    if (clock == ClockType::Default)
+        clock = _clock;
+    if ((clock == ClockType::TSC) && !System::CpuInvariantTSC())
+        clock = ClockType::Monotonic;
+    if (clock == ClockType::Default)
+        clock = ClockType::Monotonic;
+    return clock;
+}
+
+void Launcher::LaunchJobs(const std::vector<std::shared_ptr<BenchmarkBase>>& benchmarks, int& current, int& total)
+{
+    // Plan an own physical core for each job
+    std::vector<int> placement = Affinity::PlanJobs(System::CpuTopologies(), std::min(_jobs, (int)benchmarks.size()), _jobs_spread);
+
+    std::mutex mutex;
+    std::atomic<size_t> next(0);
+    std::exception_ptr error;
+
+    // Notify about the finished launch of the job
+    auto notify = [this, &mutex, &current, &total](int extra, const BenchmarkBase& benchmark, const Context& context, int attempt)
+    {
+        std::scoped_lock lock(mutex);
+        total += extra;
+        ++current;
+        onLaunching(current, total, benchmark, context, attempt);
+        onLaunched(current, total, benchmark, context, attempt);
+    };
+
+    // Each job launches the next pending benchmark till all of them are launched
+    ThreadPool pool;
+    pool.Run(placement, [this, &benchmarks, &next, &mutex, &error, &notify](int worker, int cpu)
+    {
+        Internals::JobHandler handler(notify);
+        for (size_t index = next++; index < benchmarks.size(); index = next++)
+        {
+            try
+            {
+                benchmarks[index]->Launch(handler.current, handler.total, ResolveClock(benchmarks[index]->settings()), handler);
+            }
+            catch (...)
+            {
+                std::scoped_lock lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    });
+
+    // Rethrow the first error of parallel jobs
+    if (error)
+        std::rethrow_exception(error);
 }
 
 void Launcher::Report(Reporter& reporter) const
@@ -111,25 +246,124 @@ void Launcher::ReportPhaseHistogram(int32_t resolution, const PhaseCore& phase,
 {
     if (phase.metrics().latency())
     {
-        const char deprecated[] = "\\/?%*:|\"<>";
+        // Report histogram of all attempts and kept histograms of each attempt
+        for (int attempt = -1; attempt < (int)phase.metrics().latency_attempts(); ++attempt)
+        {
+            // Validate filename
+            std::string filename(Internals::ValidateFilename(name + ((attempt < 0) ? "" : (".attempt-" + std::to_string(attempt + 1)))) + ".hdr");
 
+            // Open histogram filename
+            FILE* file = fopen(filename.c_str(), "w");
+            if (file != nullptr)
+            {
+                // Print histogram
+                phase.PrintLatencyHistogram(file, resolution, attempt);
+
+                // Close file
+                fclose(file);
+            }
+        }
+    }
+}
+
+void Launcher::ReportIntervals() const
+{
+    // For all registered benchmarks...
+    for (const auto& benchmark : _benchmarks)
+    {
+        // Filter performed benchmarks
+        if (benchmark->_launched)
+        {
+            // Report benchmark interval snapshots
+            for (const auto& root_phase : benchmark->_phases)
+                ReportPhaseIntervals(*root_phase, root_phase->name());
+        }
+    }
+}
+
+void Launcher::ReportPhaseIntervals(const PhaseCore& phase, const std::string& name) const
+{
+    const std::vector<PhaseInterval>& intervals = phase.metrics().intervals();
+    if (!intervals.empty())
+    {
         // Validate filename
-        std::string filename(name + ".hdr");
-        for (auto ch : filename)
-            if ((ch != '\\') && (ch != '/') && (std::find(deprecated, deprecated + sizeof(deprecated), ch) != (deprecated + sizeof(deprecated))))
-                ch = '_';
-
-        // Open histogram filename
-        FILE* file = fopen(filename.c_str(), "w");
-        if (file != nullptr)
+        std::string filename(Internals::ValidateFilename(name));
+
+        // Interval timestamps are reported relative to the first interval
+        uint64_t start = intervals.front().timestamp;
+
+        // Write interval snapshots as JSON lines
+        std::ofstream json(filename + ".intervals.json");
+        if (json)
+        {
+            for (const auto& interval : intervals)
+            {
+                json << "{ \"start\": " << (interval.timestamp - start)
+                     << ", \"duration\": " << interval.duration
+                     << ", \"operations\": " << interval.operations
+                     << ", \"items\": " << interval.items
+                     << ", \"bytes\": " << interval.bytes
+                     << ", \"operations_per_second\": " << interval.operations_per_second()
+                     << ", \"items_per_second\": " << interval.items_per_second()
+                     << ", \"bytes_per_second\": " << interval.bytes_per_second();
+                const hdr_histogram* histogram = (const hdr_histogram*)interval.histogram.get();
+                if ((histogram != nullptr) && (histogram->total_count > 0))
+                {
+                    json << ", \"min_latency\": " << hdr_min(histogram)
+                         << ", \"max_latency\": " << hdr_max(histogram)
+                         << ", \"mean_latency\": " << hdr_mean(histogram)
+                         << ", \"p50_latency\": " << hdr_value_at_percentile(histogram, 50.0)
+                         << ", \"p99_latency\": " << hdr_value_at_percentile(histogram, 99.0)
+                         << ", \"p999_latency\": " << hdr_value_at_percentile(histogram, 99.9);
+                }
+                json << " }\n";
+            }
+        }
+
+        // Write interval latency histograms as the HdrHistogram interval log
+        if (intervals.front().histogram)
         {
-            // Print histogram
-            phase.PrintLatencyHistogram(file, resolution);
+            FILE* file = fopen((filename + ".hlog").c_str(), "w");
+            if (file != nullptr)
+            {
+                hdr_log_writer writer;
+                hdr_log_writer_init(&writer);
 
-            // Close file
-            fclose(file);
+                // Log start time is the wall clock time of the first interval
+                uint64_t elapsed = System::Timestamp() - start;
+                int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+                int64_t epoch = now - (int64_t)elapsed;
+                hdr_timespec timestamp;
+                timestamp.tv_sec = (decltype(timestamp.tv_sec))(epoch / 1000000000);
+                timestamp.tv_nsec = (decltype(timestamp.tv_nsec))(epoch % 1000000000);
+                hdr_log_write_header(&writer, file, name.c_str(), &timestamp);
+
+                for (const auto& interval : intervals)
+                {
+                    if (!interval.histogram)
+                        continue;
+
+                    uint64_t begin = interval.timestamp - start;
+                    uint64_t end = begin + interval.duration;
+                    hdr_timespec begin_timestamp;
+                    begin_timestamp.tv_sec = (decltype(begin_timestamp.tv_sec))(begin / 1000000000);
+                    begin_timestamp.tv_nsec = (decltype(begin_timestamp.tv_nsec))(begin % 1000000000);
+                    hdr_timespec end_timestamp;
+                    end_timestamp.tv_sec = (decltype(end_timestamp.tv_sec))(end / 1000000000);
+                    end_timestamp.tv_nsec = (decltype(end_timestamp.tv_nsec))(end % 1000000000);
+                    hdr_log_write(&writer, file, &begin_timestamp, &end_timestamp, (hdr_histogram*)interval.histogram.get());
+                }
+
+                fclose(file);
+            }
         }
     }
+
+    for (const auto& child : phase._child)
+    {
+        std::string child_name = name + "." + child->name();
+        ReportPhaseIntervals(*child, child_name);
+    }
 }
 
 } // namespace CppBenchmark
@@ -12,8 +12,10 @@
 #include "benchmark/reporter_console.h"
 #include "benchmark/reporter_csv.h"
 #include "benchmark/reporter_json.h"
+#include "benchmark/trace.h"
 #include "benchmark/version.h"
 
+#include <fstream>
 #include <iomanip>
 #include <regex>
 
@@ -26,12 +28,17 @@ void LauncherConsole::Initialize(const int argc, char const* const* const argv)
     auto parser = optparse::OptionParser().version(version);
 
     const char* output[] = { "console", "csv", "json" };
+    const char* clock[] = { "monotonic", "tsc" };
 
+    parser.add_option("-c", "--clock").dest("clock").choices(&clock[0], &clock[2]).set_default(clock[0]).help("Timestamp clock (monotonic, tsc). Default: %default");
     parser.add_option("-f", "--filter").dest("filter").help("Filter benchmarks by the given regexp pattern");
+    parser.add_option("-j", "--jobs").dest("jobs").action("store").type("int").set_default(1).help("Launch single-threaded benchmarks with the given count of parallel jobs, each on its own physical core. Default: %default");
     parser.add_option("-l", "--list").dest("list").action("store_true").help("List all avaliable benchmarks");
     parser.add_option("-o", "--output").dest("output").choices(&output[0], &output[3]).set_default(output[0]).help("Output format (console, csv, json). Default: %default");
     parser.add_option("-q", "--quiet").dest("quiet").action("store_true").help("Launch in quiet mode. No progress will be shown!");
     parser.add_option("-r", "--histograms").dest("histograms").action("store").type("int").set_default(0).help("Create High Dynamic Range (HDR) Histogram files with a given resolution. Default: %default");
+    parser.add_option("-s", "--spread").dest("spread").action("store_true").help("Spread parallel jobs across last level caches");
+    parser.add_option("-t", "--trace").dest("trace").help("Write phases timeline trace into the given file in Chrome trace event format");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -56,6 +63,11 @@ void LauncherConsole::Initialize(const int argc, char const* const* const argv)
         _filter = options["filter"];
     if (options.is_set("output"))
         _output = options["output"];
+    if (options.is_set("trace"))
+        _trace = options["trace"];
+    SetJobs((int)options.get("jobs"), options.get("spread"));
+    if (options.is_set("clock"))
+        _clock = (options["clock"] == "tsc") ? ClockType::TSC : ClockType::Monotonic;
 
     // Update initialization flag
     _init = true;
@@ -76,6 +88,10 @@ void LauncherConsole::Execute()
     }
     else
     {
+        // Record phases timeline trace
+        if (!_trace.empty())
+            Trace::Enable();
+
         // Launch all suitable benchmarks
         Launcher::Launch(_filter);
     }
@@ -102,6 +118,19 @@ void LauncherConsole::Report() const
     // Report histograms
     if (_histograms > 0)
         Launcher::ReportHistograms(_histograms);
+
+    // Report interval snapshots
+    Launcher::ReportIntervals();
+
+    // Report phases timeline trace
+    if (!_trace.empty())
+    {
+        std::ofstream stream(_trace);
+        if (stream)
+            Trace::WriteJSON(stream);
+        else
+            std::cerr << Color::LIGHTRED << "Cannot open the trace file: " << _trace << std::endl;
+    }
 }
 
 void LauncherConsole::onLaunching(int current, int total, const BenchmarkBase& benchmark, const Context& context, int attempt)
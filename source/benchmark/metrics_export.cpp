@@ -0,0 +1,255 @@
+/*!
+    \file metrics_export.cpp
+    \brief Shared memory metrics export implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/metrics_export.h"
+
+#include <cstring>
+#include <limits>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppBenchmark {
+
+// Atomics of the shared memory region should be lock-free to be address-free
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory metrics export requires lock-free 64-bit atomics!");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared memory metrics export requires lock-free 32-bit atomics!");
+
+int64_t ExportMetrics::Percentile(const int64_t* buckets, double percentile) noexcept
+{
+    int64_t total = 0;
+    for (int i = 0; i < BUCKETS; ++i)
+        total += buckets[i];
+    if (total == 0)
+        return 0;
+
+    // Find the first bucket which covers the required count of operations
+    int64_t required = std::max((int64_t)((percentile / 100.0) * total + 0.5), (int64_t)1);
+    int64_t count = 0;
+    for (int i = 0; i < BUCKETS; ++i)
+    {
+        count += buckets[i];
+        if (count >= required)
+            return (i == 0) ? 0 : (i < 63) ? ((int64_t)1 << i) : std::numeric_limits<int64_t>::max();
+    }
+    return std::numeric_limits<int64_t>::max();
+}
+
+bool MetricsExport::Create(const std::string& path, uint32_t capacity)
+{
+    if (!Map(path, capacity, true))
+        return false;
+
+    // Initialize the region header. Slots are zero filled by the new file.
+    std::memcpy(_header->magic, MAGIC, sizeof(MAGIC));
+    _header->version = VERSION;
+    _header->capacity = capacity;
+    _header->count.store(0, std::memory_order_relaxed);
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    _header->process = (uint32_t)getpid();
+#elif defined(_WIN32) || defined(_WIN64)
+    _header->process = (uint32_t)GetCurrentProcessId();
+#endif
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return true;
+}
+
+bool MetricsExport::Open(const std::string& path)
+{
+    if (!Map(path, 0, false))
+        return false;
+
+    // Validate the region header
+    if ((std::memcmp(_header->magic, MAGIC, sizeof(MAGIC)) != 0) || (_header->version != VERSION) ||
+        (_size < sizeof(ExportHeader) + (size_t)_header->capacity * sizeof(ExportSlot)))
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+bool MetricsExport::Map(const std::string& path, uint32_t capacity, bool create)
+{
+    Close();
+
+    size_t size = sizeof(ExportHeader) + (size_t)capacity * sizeof(ExportSlot);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Unlink the previous region file to keep it valid for attached readers
+    if (create)
+        unlink(path.c_str());
+
+    int file = create ? open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644) : open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+
+    if (create)
+    {
+        if (ftruncate(file, (off_t)size) != 0)
+        {
+            close(file);
+            return false;
+        }
+    }
+    else
+    {
+        struct stat info;
+        if ((fstat(file, &info) != 0) || ((size_t)info.st_size < sizeof(ExportHeader)))
+        {
+            close(file);
+            return false;
+        }
+        size = (size_t)info.st_size;
+    }
+
+    void* address = mmap(nullptr, size, create ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, file, 0);
+    close(file);
+    if (address == MAP_FAILED)
+        return false;
+
+    _header = (ExportHeader*)address;
+    _size = size;
+    return true;
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(path.c_str(), create ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, create ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    if (!create)
+    {
+        LARGE_INTEGER info;
+        if (!GetFileSizeEx(file, &info) || ((size_t)info.QuadPart < sizeof(ExportHeader)))
+        {
+            CloseHandle(file);
+            return false;
+        }
+        size = (size_t)info.QuadPart;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, create ? PAGE_READWRITE : PAGE_READONLY, (DWORD)((uint64_t)size >> 32), (DWORD)size, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* address = MapViewOfFile(mapping, create ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+    if (address == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    _header = (ExportHeader*)address;
+    _size = size;
+    _file = file;
+    _mapping = mapping;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void MetricsExport::Close() noexcept
+{
+    if (_header == nullptr)
+        return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    munmap(_header, _size);
+#elif defined(_WIN32) || defined(_WIN64)
+    UnmapViewOfFile(_header);
+    CloseHandle((HANDLE)_mapping);
+    CloseHandle((HANDLE)_file);
+#endif
+
+    _header = nullptr;
+    _size = 0;
+    _file = nullptr;
+    _mapping = nullptr;
+}
+
+ExportSlot* MetricsExport::Allocate(const std::string& name, uint64_t thread) noexcept
+{
+    if (_header == nullptr)
+        return nullptr;
+
+    uint32_t index = _header->count.fetch_add(1, std::memory_order_relaxed);
+    if (index >= _header->capacity)
+        return nullptr;
+
+    ExportSlot* slot = &slots()[index];
+
+    // Fill the new slot. Readers skip the slot until its sequence is published.
+    slot->thread = thread;
+    size_t length = std::min(name.size(), (size_t)ExportSlot::NAME - 1);
+    std::memcpy(slot->name, name.data(), length);
+    slot->name[length] = 0;
+    slot->min_latency.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+    slot->max_latency.store(0, std::memory_order_relaxed);
+    slot->sequence.store(2, std::memory_order_release);
+
+    return slot;
+}
+
+bool MetricsExport::Read(uint32_t index, ExportMetrics& metrics) const
+{
+    if (index >= count())
+        return false;
+
+    const ExportSlot* slot = &slots()[index];
+
+    for (int attempt = 0; ; ++attempt)
+    {
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+        // Skip not allocated slot
+        if (sequence == 0)
+            return false;
+
+        // Retry while the slot is updated (the slot might be left locked by the crashed process)
+        if ((sequence & 1) != 0)
+        {
+            if (attempt >= 1000000)
+                return false;
+            continue;
+        }
+
+        metrics.calls = slot->calls.load(std::memory_order_relaxed);
+        metrics.operations = slot->operations.load(std::memory_order_relaxed);
+        metrics.total_time = slot->total_time.load(std::memory_order_relaxed);
+        metrics.min_latency = slot->min_latency.load(std::memory_order_relaxed);
+        metrics.max_latency = slot->max_latency.load(std::memory_order_relaxed);
+        for (int i = 0; i < ExportMetrics::BUCKETS; ++i)
+            metrics.buckets[i] = slot->buckets[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) == sequence)
+            break;
+    }
+
+    // Name and thread are immutable after the slot is allocated
+    metrics.name = std::string(slot->name, strnlen(slot->name, ExportSlot::NAME));
+    metrics.thread = slot->thread;
+    if (metrics.operations == 0)
+        metrics.min_latency = 0;
+
+    return true;
+}
+
+} // namespace CppBenchmark
@@ -14,54 +14,174 @@ namespace CppBenchmark {
 
 std::shared_ptr<Phase> PhaseCore::StartPhase(const std::string& phase)
 {
-    std::shared_ptr<PhaseCore> result;
+    std::shared_ptr<PhaseCore> result = FindPhase(phase);
 
+    // Start new operation for the child phase
+    PhaseHandle(this, result.get()).Start();
+
+    return result;
+}
+
+std::shared_ptr<Phase> PhaseCore::StartPhaseThreadSafe(const std::string& phase)
+{
+    std::shared_ptr<PhaseCore> result = FindPhaseThreadSafe(phase);
+
+    // Start new operation for the child phase
+    PhaseHandle(this, result.get()).Start();
+
+    return result;
+}
+
+std::shared_ptr<PhaseCore> PhaseCore::FindPhase(const std::string& phase)
+{
     // Find or create a sub phase with the given name
     auto it = std::find_if(_child.begin(), _child.end(), [&phase](const std::shared_ptr<PhaseCore>& item) { return item->name() == phase; });
     if (it == _child.end())
     {
-        result = std::make_shared<PhaseCore>(phase);
-        _child.emplace_back(result);
+        auto result = std::make_shared<PhaseCore>(phase);
+        result->_metrics_result._attempt_metrics_keep = _metrics_result._attempt_metrics_keep;
+        if (_export_slot != nullptr)
+            result->SetExport(_export, std::string(_export_slot->name) + "." + phase);
+
+        // Update phase collection under lock guard to synchronize with the executor report...
+        std::scoped_lock lock(_mutex);
+        it = _child.emplace(_child.end(), result);
     }
+
+    return *it;
+}
+
+std::shared_ptr<PhaseCore> PhaseCore::FindPhaseThreadSafe(const std::string& phase)
+{
+    // Update phase collection under lock guard...
+    std::scoped_lock lock(_mutex);
+
+    // Find or create a sub phase with the given name
+    auto it = std::find_if(_child.begin(), _child.end(), [&phase](const std::shared_ptr<PhaseCore>& item)
+    {
+        return ((item->name() == phase) && (item->_thread == System::CurrentThreadId()));
+    });
+    if (it == _child.end())
+    {
+        it = _child.emplace(_child.end(), std::make_shared<PhaseCore>(phase));
+        (*it)->_metrics_result._attempt_metrics_keep = _metrics_result._attempt_metrics_keep;
+        if (_export_slot != nullptr)
+            (*it)->SetExport(_export, std::string(_export_slot->name) + "." + phase);
+    }
+
+    return *it;
+}
+
+void PhaseCore::InitCounters(const PhaseCore& parent)
+{
+    // Performance counters group could be read only by the thread which opened it
+    const std::shared_ptr<Counters>& group = parent._metrics_current._counters_group;
+    if (group && (group->thread() == System::CurrentThreadId()))
+        _metrics_current.InitCounters(group);
     else
-        result = *it;
+        _metrics_current.InitCounters();
+}
 
-    // Start new operation for the child phase
-    result->StartCollectingMetrics();
+void PhaseCore::SetSampling(const Sampling& sampling) noexcept
+{
+    _sampling = sampling;
+    _sampling_enabled = (sampling.type() != SamplingType::None);
+    _sampling_skip = false;
+    _sampling_stride = 1;
+    _sampling_countdown = 1;
+    _sampling_random = System::Timestamp() ^ (uint64_t)(uintptr_t)this ^ 0x9E3779B97F4A7C15ull;
+    _sampling_timestamp = (int64_t)System::Timestamp();
+}
 
-    // Add new metrics operation
-    result->_metrics_current.AddOperations(1);
+void PhaseCore::UpdateSampling() noexcept
+{
+    // Only budget policy requires the duration since the previous sampled call
+    int64_t duration = 0;
+    if (_sampling.type() == SamplingType::Budget)
+    {
+        int64_t timestamp = (int64_t)System::Timestamp();
+        duration = timestamp - _sampling_timestamp;
+        _sampling_timestamp = timestamp;
+    }
 
-    return result;
+    _sampling_stride = _sampling.Stride(_sampling_random, _sampling_stride, duration);
+    _sampling_countdown = _sampling_stride;
 }
 
-std::shared_ptr<Phase> PhaseCore::StartPhaseThreadSafe(const std::string& phase)
+void PhaseCore::ExportOperation() noexcept
 {
-    std::shared_ptr<PhaseCore> result;
+    int64_t operations = std::max(_metrics_current._total_operations - _metrics_current._iterstamp, (int64_t)0);
+    int64_t total_time = _metrics_current._total_time;
 
-    // Update phase collection under lock guard...
+    StopCollectingMetrics();
+
+    // Count of calls since the previous export (current metrics might be reset by the window)
+    int64_t calls = operations;
+    if (_sampling_enabled)
     {
-        std::scoped_lock lock(_mutex);
+        calls = _metrics_current._sampling_calls - _export_calls;
+        if (calls < 0)
+            calls = _metrics_current._sampling_calls;
+        _export_calls = _metrics_current._sampling_calls;
+    }
+
+    _export_slot->Publish(calls, operations, _metrics_current._total_time - total_time);
+}
+
+void PhaseCore::SetExport(MetricsExport* metrics, const std::string& name) noexcept
+{
+    _export = metrics;
+    _export_slot = (metrics != nullptr) ? metrics->Allocate(name, System::CurrentThreadId()) : nullptr;
+    _export_calls = 0;
+}
 
-        // Find or create a sub phase with the given name
-        auto it = std::find_if(_child.begin(), _child.end(), [&phase](const std::shared_ptr<PhaseCore>& item)
+void PhaseCore::TraceBegin() noexcept
+{
+    // Register the trace phase name once
+    if (_trace_name < 0)
+    {
+        try
         {
-            return ((item->name() == phase) && (item->_thread == System::CurrentThreadId()));
-        });
-        if (it == _child.end())
+            _trace_name = Trace::Register(_name);
+        }
+        catch (...)
         {
-            result = std::make_shared<PhaseCore>(phase);
-            _child.emplace_back(result);
+            return;
         }
-        else
-            result = *it;
     }
 
-    // Start new operation for the child phase
-    result->StartCollectingMetrics();
+    Trace::Begin((uint32_t)_trace_name);
+}
+
+void PhaseCore::TraceEnd() noexcept
+{
+    if (_trace_name >= 0)
+        Trace::End((uint32_t)_trace_name);
+}
+
+void PhaseCore::PublishWindow()
+{
+    _window_published = _window->load(std::memory_order_acquire);
+
+    // Update window snapshot under lock guard...
+    std::scoped_lock lock(_mutex);
+
+    // Keep current metrics for the next window until the previous snapshot is taken
+    if (!_window_snapshot)
+        _window_snapshot = SnapshotMetrics();
+}
+
+std::shared_ptr<PhaseCore> PhaseCore::SnapshotMetrics()
+{
+    auto result = std::make_shared<PhaseCore>(_name);
+
+    // Move current metrics into the snapshot result metrics
+    result->_metrics_result.MergeMetrics(_metrics_current);
+    _metrics_current.ResetMetrics();
 
-    // Add new metrics operation
-    result->_metrics_current.AddOperations(1);
+    // Snapshot child phases
+    for (const auto& child : _child)
+        result->_child.emplace_back(child->SnapshotMetrics());
 
     return result;
 }
@@ -0,0 +1,73 @@
+/*!
+    \file phase_handle.cpp
+    \brief Benchmark phase handle implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/phase_handle.h"
+
+#include "benchmark/phase_core.h"
+
+namespace CppBenchmark {
+
+const std::string& PhaseHandle::name() const noexcept
+{
+    static const std::string empty("<none>");
+    return _phase ? _phase->name() : empty;
+}
+
+const PhaseMetrics& PhaseHandle::metrics() const noexcept
+{
+    static const PhaseMetrics empty;
+    return _phase ? _phase->metrics() : empty;
+}
+
+PhaseHandle PhaseHandle::ResolvePhase(const std::string& phase) const
+{
+    return _phase ? _phase->ResolvePhase(phase) : PhaseHandle();
+}
+
+void PhaseHandle::Start() const
+{
+    if (_phase == nullptr)
+        return;
+
+    // Publish metrics window of the root phase between its operations
+    if (_parent == nullptr)
+        _phase->UpdateWindow();
+
+    // Skip unsampled operations
+    if (!_phase->SampleOperation(_parent))
+        return;
+
+    // Collect performance counters and resources usage of the child phase with the parent one
+    // (child phase of the same thread reads deltas of the parent performance counters group)
+    if (_parent != nullptr)
+    {
+        if (_parent->_metrics_current.counters() && !_phase->_metrics_current.counters())
+            _phase->InitCounters(*_parent);
+        if (_parent->_metrics_current.resources() && !_phase->_metrics_current.resources())
+            _phase->InitResources();
+    }
+
+    // Start new operation for the phase
+    _phase->StartCollectingMetrics();
+
+    // Add new metrics operation
+    _phase->_metrics_current.AddOperations(1);
+}
+
+void PhaseHandle::Stop() const noexcept
+{
+    if (_phase != nullptr)
+        _phase->StopOperation();
+}
+
+Phase* PhaseHandleScope::operator->() const noexcept
+{
+    return _handle._phase;
+}
+
+} // namespace CppBenchmark
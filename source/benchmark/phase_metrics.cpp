@@ -21,7 +21,34 @@
 
 namespace CppBenchmark {
 
-PhaseMetrics::PhaseMetrics() : _histogram(nullptr)
+//! @cond INTERNALS
+namespace Internals {
+
+// Add the source latency histogram into the target one created with the given parameters on demand
+void AddLatencyHistogram(void*& target, const void* source, const std::tuple<int64_t, int64_t, int>& latency) noexcept
+{
+    if (source == nullptr)
+        return;
+
+    if ((target == nullptr) && (hdr_init(std::get<0>(latency), std::get<1>(latency), std::get<2>(latency), ((hdr_histogram**)&target)) != 0))
+    {
+        target = nullptr;
+        return;
+    }
+
+    hdr_add((hdr_histogram*)target, (const hdr_histogram*)source);
+}
+
+// Close the latency histogram owned by the interval snapshot
+void CloseLatencyHistogram(void* histogram) noexcept
+{
+    hdr_close((hdr_histogram*)histogram);
+}
+
+} // namespace Internals
+//! @endcond
+
+PhaseMetrics::PhaseMetrics() : _histogram(nullptr), _latency_attempts(false), _interval_histogram(nullptr), _attempt_metrics_keep(false)
 {
     ResetMetrics();
 }
@@ -56,6 +83,11 @@ double PhaseMetrics::stdv_latency() const noexcept
     return latency() ? hdr_stddev((const hdr_histogram*)_histogram) : 0;
 }
 
+int64_t PhaseMetrics::percentile_latency(double percentile) const noexcept
+{
+    return latency() ? hdr_value_at_percentile((const hdr_histogram*)_histogram, percentile) : 0;
+}
+
 int64_t PhaseMetrics::avg_time() const noexcept
 {
     return (_total_operations > 0) ? (_total_time / _total_operations) : 0;
@@ -71,6 +103,50 @@ int64_t PhaseMetrics::max_time() const noexcept
     return _max_time;
 }
 
+int64_t PhaseMetrics::avg_time_corrected() const noexcept
+{
+    int64_t time = avg_time();
+    return (time > _overhead_time) ? (time - _overhead_time) : 0;
+}
+
+int64_t PhaseMetrics::min_time_corrected() const noexcept
+{
+    int64_t time = min_time();
+    return (time > _overhead_time) ? (time - _overhead_time) : 0;
+}
+
+int64_t PhaseMetrics::max_time_corrected() const noexcept
+{
+    int64_t time = max_time();
+    return (time > _overhead_time) ? (time - _overhead_time) : 0;
+}
+
+int64_t PhaseMetrics::min_latency_corrected() const noexcept
+{
+    int64_t latency = min_latency();
+    return (latency > _overhead_latency) ? (latency - _overhead_latency) : 0;
+}
+
+int64_t PhaseMetrics::max_latency_corrected() const noexcept
+{
+    int64_t latency = max_latency();
+    return (latency > _overhead_latency) ? (latency - _overhead_latency) : 0;
+}
+
+double PhaseMetrics::mean_latency_corrected() const noexcept
+{
+    double latency = mean_latency();
+    return (latency > _overhead_latency) ? (latency - _overhead_latency) : 0;
+}
+
+double PhaseMetrics::ipc() const noexcept
+{
+    if (!counter_available(CounterType::Cycles) || !counter_available(CounterType::Instructions) || (counter(CounterType::Cycles) <= 0))
+        return 0.0;
+
+    return (double)counter(CounterType::Instructions) / counter(CounterType::Cycles);
+}
+
 int64_t PhaseMetrics::operations_per_second() const noexcept
 {
     if (_total_time <= 0)
@@ -79,6 +155,14 @@ int64_t PhaseMetrics::operations_per_second() const noexcept
     return System::MulDiv64(_total_operations, 1000000000, _total_time);
 }
 
+int64_t PhaseMetrics::overlap_operations_per_second() const noexcept
+{
+    if ((_overlap_time <= 0) || (_overlap_operations < 0))
+        return 0;
+
+    return System::MulDiv64(_overlap_operations, 1000000000, _overlap_time);
+}
+
 int64_t PhaseMetrics::items_per_second() const noexcept
 {
     if (_total_time <= 0)
@@ -95,7 +179,7 @@ int64_t PhaseMetrics::bytes_per_second() const noexcept
     return System::MulDiv64(_total_bytes, 1000000000, _total_time);
 }
 
-void PhaseMetrics::InitLatencyHistogram(const std::tuple<int64_t, int64_t, int>& latency) noexcept
+void PhaseMetrics::InitLatencyHistogram(const std::tuple<int64_t, int64_t, int>& latency, bool attempts) noexcept
 {
     int64_t lowest = std::get<0>(latency);
     int64_t highest = std::get<1>(latency);
@@ -105,13 +189,85 @@ void PhaseMetrics::InitLatencyHistogram(const std::tuple<int64_t, int64_t, int>&
     int result = hdr_init(lowest, highest, significant, ((hdr_histogram**)&_histogram));
     if (result != 0)
         _histogram = nullptr;
+
+    _latency_params = latency;
+    _latency_attempts = attempts;
 }
 
-void PhaseMetrics::PrintLatencyHistogram(FILE* file, int32_t resolution) const noexcept
+void PhaseMetrics::PrintLatencyHistogram(FILE* file, int32_t resolution, int attempt) const noexcept
 {
-    if ((_histogram != nullptr) && (file != nullptr))
+    void* histogram = _histogram;
+    if (attempt >= 0)
+        histogram = ((size_t)attempt < _attempt_histograms.size()) ? _attempt_histograms[attempt] : nullptr;
+
+    if ((histogram != nullptr) && (file != nullptr))
     {
-        hdr_percentiles_print((hdr_histogram*)_histogram, file, resolution, 1.0, CLASSIC);
+        hdr_percentiles_print((hdr_histogram*)histogram, file, resolution, 1.0, CLASSIC);
+    }
+}
+
+void PhaseMetrics::MergeLatencyHistograms(PhaseMetrics& metrics) noexcept
+{
+    if ((metrics._histogram == nullptr) && metrics._attempt_histograms.empty())
+        return;
+
+    // Merged histograms will be created with parameters of the first merged metrics
+    if ((_histogram == nullptr) && _attempt_histograms.empty())
+        _latency_params = metrics._latency_params;
+
+    // Combine latency of all attempts and threads
+    Internals::AddLatencyHistogram(_histogram, metrics._histogram, _latency_params);
+
+    if (!metrics._attempt_histograms.empty())
+    {
+        // Combine latency of the same attempt of different threads
+        if (_attempt_histograms.size() < metrics._attempt_histograms.size())
+            _attempt_histograms.resize(metrics._attempt_histograms.size(), nullptr);
+        for (size_t i = 0; i < metrics._attempt_histograms.size(); ++i)
+            Internals::AddLatencyHistogram(_attempt_histograms[i], metrics._attempt_histograms[i], _latency_params);
+    }
+    else if (metrics._latency_attempts && (metrics._histogram != nullptr))
+    {
+        // Keep latency histogram of the merged attempt
+        _attempt_histograms.push_back(metrics._histogram);
+        metrics._histogram = nullptr;
+    }
+}
+
+void PhaseMetrics::MergeIntervals(const PhaseMetrics& metrics)
+{
+    // Combine interval snapshots with the same index
+    if (_intervals.size() < metrics._intervals.size())
+        _intervals.resize(metrics._intervals.size());
+    for (size_t i = 0; i < metrics._intervals.size(); ++i)
+    {
+        PhaseInterval& target = _intervals[i];
+        const PhaseInterval& source = metrics._intervals[i];
+
+        // Combined interval covers all merged intervals
+        if ((target.timestamp == 0) && (target.duration == 0))
+        {
+            target.timestamp = source.timestamp;
+            target.duration = source.duration;
+        }
+        else
+        {
+            uint64_t stop = std::max(target.timestamp + target.duration, source.timestamp + source.duration);
+            target.timestamp = std::min(target.timestamp, source.timestamp);
+            target.duration = stop - target.timestamp;
+        }
+
+        target.operations += source.operations;
+        target.items += source.items;
+        target.bytes += source.bytes;
+
+        if (source.histogram)
+        {
+            void* histogram = target.histogram.get();
+            Internals::AddLatencyHistogram(histogram, source.histogram.get(), metrics._latency_params);
+            if (!target.histogram && (histogram != nullptr))
+                target.histogram = std::shared_ptr<void>(histogram, Internals::CloseLatencyHistogram);
+        }
     }
 }
 
@@ -122,16 +278,225 @@ void PhaseMetrics::FreeLatencyHistogram() noexcept
         hdr_close((hdr_histogram*)_histogram);
         _histogram = nullptr;
     }
+
+    _interval_histogram = nullptr;
+    _interval_current.reset();
+    _interval_pool.clear();
+
+    for (auto histogram : _attempt_histograms)
+        if (histogram != nullptr)
+            hdr_close((hdr_histogram*)histogram);
+    _attempt_histograms.clear();
+}
+
+void PhaseMetrics::AddLatency(int64_t latency, int64_t count) noexcept
+{
+    if (_histogram != nullptr)
+        hdr_record_values((hdr_histogram*)_histogram, latency, count);
+    if (_interval_histogram != nullptr)
+        hdr_record_values((hdr_histogram*)_interval_histogram, latency, count);
+}
+
+void PhaseMetrics::InitSamples(int64_t capacity, bool reservoir)
+{
+    _samples.clear();
+    _samples.reserve((size_t)capacity);
+    _samples_capacity = capacity;
+    _samples_reservoir = reservoir;
+    _samples_thread = System::CurrentThreadId();
+    _samples_random = 0x9E3779B97F4A7C15ull ^ _samples_thread;
+    _total_samples = 0;
+}
+
+void PhaseMetrics::InitCounters()
+{
+    _counters_group = std::make_shared<Counters>();
+    _counters_mask = _counters_group->mask();
+    if (_counters_mask == 0)
+        _counters_group.reset();
+}
+
+void PhaseMetrics::InitCounters(const std::shared_ptr<Counters>& group) noexcept
+{
+    _counters_group = group;
+    _counters_mask = group ? group->mask() : 0;
+}
+
+void PhaseMetrics::InitResources() noexcept
+{
+    _resources = true;
+}
+
+void PhaseMetrics::AddSample(uint64_t timestamp, uint64_t duration, int64_t operations) noexcept
+{
+    if (_samples_capacity <= 0)
+        return;
+
+    PhaseSample sample = { timestamp, duration, operations, _samples_thread };
+
+    int64_t index = _total_samples++;
+    if (index < _samples_capacity)
+    {
+        // Fill the preallocated buffer
+        _samples.push_back(sample);
+    }
+    else if (_samples_reservoir)
+    {
+        // Update the random value (xorshift64)
+        _samples_random ^= _samples_random << 13;
+        _samples_random ^= _samples_random >> 7;
+        _samples_random ^= _samples_random << 17;
+
+        // Replace the random sample with the probability of capacity / total
+        uint64_t position = _samples_random % (uint64_t)(index + 1);
+        if (position < (uint64_t)_samples_capacity)
+            _samples[position] = sample;
+    }
+    else
+    {
+        // Overwrite the oldest sample
+        _samples[index % _samples_capacity] = sample;
+    }
 }
 
-void PhaseMetrics::AddLatency(int64_t latency) noexcept
+void PhaseMetrics::InitIntervals(int64_t period, int64_t capacity)
 {
+    _interval_period = period;
+    _interval_capacity = std::max(capacity, (int64_t)2);
+    _intervals.reserve((size_t)_interval_capacity);
+
+    // Latency of each interval is recorded into a separate histogram with the same parameters.
+    // All histograms are allocated here, so operations loop only takes them from the pool.
     if (_histogram != nullptr)
-        hdr_record_values((hdr_histogram*)_histogram, latency, 1);
+    {
+        size_t required = (size_t)_interval_capacity + ((_interval_current) ? 0 : 1);
+        while (_interval_pool.size() < required)
+        {
+            hdr_histogram* histogram = nullptr;
+            if (hdr_init(std::get<0>(_latency_params), std::get<1>(_latency_params), std::get<2>(_latency_params), &histogram) != 0)
+                break;
+            _interval_pool.emplace_back(histogram, Internals::CloseLatencyHistogram);
+        }
+        if (!_interval_current && !_interval_pool.empty())
+        {
+            _interval_current = std::move(_interval_pool.back());
+            _interval_pool.pop_back();
+        }
+        _interval_histogram = _interval_current.get();
+    }
+}
+
+void PhaseMetrics::StartInterval(uint64_t timestamp) noexcept
+{
+    _interval_timestamp = timestamp;
+    _interval_operations = _total_operations;
+    _interval_items = _total_items;
+    _interval_bytes = _total_bytes;
+    if (_interval_histogram != nullptr)
+        hdr_reset((hdr_histogram*)_interval_histogram);
+}
+
+void PhaseMetrics::StopInterval(uint64_t timestamp)
+{
+    // Add the last incomplete interval
+    if ((timestamp > _interval_timestamp) && (_total_operations > _interval_operations))
+        AddInterval(timestamp);
+}
+
+void PhaseMetrics::AddInterval(uint64_t timestamp)
+{
+    PhaseInterval interval;
+    interval.timestamp = _interval_timestamp;
+    interval.duration = timestamp - _interval_timestamp;
+    interval.operations = _total_operations - _interval_operations;
+    interval.items = _total_items - _interval_items;
+    interval.bytes = _total_bytes - _interval_bytes;
+
+    // Hand over the interval latency histogram to the snapshot and take the next one from the pool
+    if (_interval_histogram != nullptr)
+    {
+        interval.histogram = std::move(_interval_current);
+        if (!_interval_pool.empty())
+        {
+            _interval_current = std::move(_interval_pool.back());
+            _interval_pool.pop_back();
+        }
+        _interval_histogram = _interval_current.get();
+    }
+
+    // Keep the count of interval snapshots bounded
+    if ((int64_t)_intervals.size() >= _interval_capacity)
+        CompactIntervals();
+
+    _intervals.emplace_back(std::move(interval));
+
+    StartInterval(timestamp);
+}
+
+void PhaseMetrics::CompactIntervals()
+{
+    // Merge pairs of adjacent intervals, so the period of retained intervals is doubled
+    size_t count = 0;
+    for (size_t i = 0; i < _intervals.size(); i += 2, ++count)
+    {
+        PhaseInterval merged = std::move(_intervals[i]);
+        if ((i + 1) < _intervals.size())
+        {
+            PhaseInterval& next = _intervals[i + 1];
+            merged.duration = next.timestamp + next.duration - merged.timestamp;
+            merged.operations += next.operations;
+            merged.items += next.items;
+            merged.bytes += next.bytes;
+
+            if (next.histogram)
+            {
+                // Histogram shared with metrics snapshots must not be changed
+                void* histogram = (merged.histogram.use_count() == 1) ? merged.histogram.get() : nullptr;
+                if (histogram == nullptr)
+                    Internals::AddLatencyHistogram(histogram, merged.histogram.get(), _latency_params);
+                Internals::AddLatencyHistogram(histogram, next.histogram.get(), _latency_params);
+                if (histogram != merged.histogram.get())
+                    merged.histogram = std::shared_ptr<void>(histogram, Internals::CloseLatencyHistogram);
+
+                // Return the released histogram to the pool
+                if (next.histogram.use_count() == 1)
+                {
+                    hdr_reset((hdr_histogram*)next.histogram.get());
+                    _interval_pool.emplace_back(std::move(next.histogram));
+                }
+            }
+        }
+        _intervals[count] = std::move(merged);
+    }
+    _intervals.resize(count);
+    _interval_period *= 2;
+
+    // Take the current histogram from the pool if it was not available
+    if ((_interval_histogram == nullptr) && !_interval_pool.empty())
+    {
+        _interval_current = std::move(_interval_pool.back());
+        _interval_pool.pop_back();
+        _interval_histogram = _interval_current.get();
+    }
 }
 
 void PhaseMetrics::StartCollecting() noexcept
 {
+    // Read performance counters and resources usage before the timestamp to exclude reading from the phase time
+    if (_counters_group)
+        _counters_group->Read(_counters_start);
+    if (_resources)
+        _resource_usage_start = System::CurrentThreadResourceUsage();
+
+    // Reset the peak of live bytes of the current thread to track the phase peak
+    if (Allocations::enabled())
+    {
+        AllocationCounters& counters = Allocations::current();
+        _allocations = true;
+        _allocation_start = counters;
+        counters.peak = counters.live;
+    }
+
     _iterstamp = _total_operations;
     _timestamp = System::Timestamp();
 }
@@ -152,10 +517,145 @@ void PhaseMetrics::StopCollecting() noexcept
     if (max_time > _max_time)
         _max_time = max_time;
     _total_time += duration;
+
+    // Update performance counters
+    if (_counters_group)
+    {
+        Counters::Values values(_counters_start);
+        _counters_group->Read(values);
+        for (int i = 0; i < Counters::COUNT; ++i)
+            _counters[i] += values[i] - _counters_start[i];
+    }
+
+    // Update heap allocations
+    if (_allocations)
+    {
+        AllocationCounters& counters = Allocations::current();
+        _allocation_counters.allocations += counters.allocations - _allocation_start.allocations;
+        _allocation_counters.frees += counters.frees - _allocation_start.frees;
+        _allocation_counters.bytes += counters.bytes - _allocation_start.bytes;
+        _allocation_counters.live += counters.live - _allocation_start.live;
+        _allocation_counters.peak = std::max(_allocation_counters.peak, counters.peak - _allocation_start.live);
+
+        // Restore the peak of live bytes for outer phases
+        counters.peak = std::max(counters.peak, _allocation_start.peak);
+    }
+
+    // Update resources usage
+    if (_resources)
+    {
+        ResourceUsage usage = System::CurrentThreadResourceUsage();
+        _resource_usage.cpu_time += usage.cpu_time - _resource_usage_start.cpu_time;
+        _resource_usage.user_time += usage.user_time - _resource_usage_start.user_time;
+        _resource_usage.system_time += usage.system_time - _resource_usage_start.system_time;
+        _resource_usage.minor_faults += usage.minor_faults - _resource_usage_start.minor_faults;
+        _resource_usage.major_faults += usage.major_faults - _resource_usage_start.major_faults;
+        _resource_usage.voluntary_switches += usage.voluntary_switches - _resource_usage_start.voluntary_switches;
+        _resource_usage.involuntary_switches += usage.involuntary_switches - _resource_usage_start.involuntary_switches;
+    }
+}
+
+void PhaseMetrics::AssignMetrics(const PhaseMetrics& metrics)
+{
+    // Overwrite metrics custom tables
+    for (const auto& it : metrics._custom_int)
+        _custom_int[it.first] = it.second;
+    for (const auto& it : metrics._custom_uint)
+        _custom_uint[it.first] = it.second;
+    for (const auto& it : metrics._custom_int64)
+        _custom_int64[it.first] = it.second;
+    for (const auto& it : metrics._custom_uint64)
+        _custom_uint64[it.first] = it.second;
+    for (const auto& it : metrics._custom_flt)
+        _custom_flt[it.first] = it.second;
+    for (const auto& it : metrics._custom_dbl)
+        _custom_dbl[it.first] = it.second;
+    for (const auto& it : metrics._custom_str)
+        _custom_str[it.first] = it.second;
+
+    _sampling_calls = metrics._sampling_calls;
+
+    // Overwrite metrics threads value
+    _threads = metrics._threads;
+    _cpu = metrics._cpu;
+
+    // Overwrite metrics running timestamps and overlap window
+    _running_start = metrics._running_start;
+    _running_stop = metrics._running_stop;
+    _overlap = metrics._overlap;
+    _start_skew = metrics._start_skew;
+    _overlap_time = metrics._overlap_time;
+    _overlap_operations = metrics._overlap_operations;
+
+    // Overwrite metrics interval snapshots
+    _intervals = metrics._intervals;
+
+    // Overwrite metrics performance counters
+    _counters_mask = metrics._counters_mask;
+    _counters = metrics._counters;
+
+    // Overwrite metrics resources usage
+    _resources = metrics._resources;
+    _resource_usage = metrics._resource_usage;
+
+    // Overwrite metrics heap allocations
+    _allocations = metrics._allocations;
+    _allocation_counters = metrics._allocation_counters;
+
+    // Overwrite metrics harness overhead values
+    _overhead = metrics._overhead;
+    _overhead_time = metrics._overhead_time;
+    _overhead_latency = metrics._overhead_latency;
+}
+
+void PhaseMetrics::AssignSamples(const PhaseMetrics& metrics)
+{
+    _samples = metrics._samples;
+    _samples_capacity = metrics._samples_capacity;
+    _samples_reservoir = metrics._samples_reservoir;
+    _samples_thread = metrics._samples_thread;
+    _total_samples = metrics._total_samples;
+}
+
+void PhaseMetrics::AppendSamples(const PhaseMetrics& metrics)
+{
+    // Samples of each thread are tagged with its thread Id
+    _samples.insert(_samples.end(), metrics._samples.begin(), metrics._samples.end());
+    _samples_capacity += metrics._samples_capacity;
+    _samples_reservoir = _samples_reservoir || metrics._samples_reservoir;
+    _total_samples += metrics._total_samples;
 }
 
 void PhaseMetrics::MergeMetrics(PhaseMetrics& metrics)
 {
+    // Collect attempts of the merged metrics
+    if (!metrics._attempts.empty())
+    {
+        _attempts.insert(_attempts.end(), metrics._attempts.begin(), metrics._attempts.end());
+        _attempt_metrics.insert(_attempt_metrics.end(), metrics._attempt_metrics.begin(), metrics._attempt_metrics.end());
+    }
+    else if (metrics._total_time > 0)
+    {
+        _attempts.push_back({ metrics._total_time, metrics._total_operations, metrics._total_items, metrics._total_bytes, false });
+
+        // Keep complete metrics of the attempt to select it later
+        if (_attempt_metrics_keep)
+        {
+            auto attempt = std::make_shared<PhaseMetrics>();
+            attempt->_min_time = metrics._min_time;
+            attempt->_max_time = metrics._max_time;
+            attempt->_total_time = metrics._total_time;
+            attempt->_total_operations = metrics._total_operations;
+            attempt->_total_items = metrics._total_items;
+            attempt->_total_bytes = metrics._total_bytes;
+            attempt->_latency_params = metrics._latency_params;
+            Internals::AddLatencyHistogram(attempt->_histogram, metrics._histogram, metrics._latency_params);
+            attempt->AssignMetrics(metrics);
+            attempt->AssignSamples(metrics);
+            _attempt_metrics.emplace_back(attempt);
+        }
+    }
+
     // Choose best min time
     if (metrics._min_time < _min_time)
         _min_time = metrics._min_time;
@@ -173,48 +673,156 @@ void PhaseMetrics::MergeMetrics(PhaseMetrics& metrics)
     _custom_dbl.insert(metrics._custom_dbl.begin(), metrics._custom_dbl.end());
     _custom_str.insert(metrics._custom_str.begin(), metrics._custom_str.end());
 
+    // Merge latency histograms
+    MergeLatencyHistograms(metrics);
+
+    // Combine samples of results merged from other threads, keep samples of the best attempt otherwise
+    bool combined = !metrics._attempts.empty();
+    if (combined)
+        AppendSamples(metrics);
+
     // Choose best total time with operations, items and bytes
     if (metrics._total_time < _total_time)
     {
-        std::swap(_histogram, metrics._histogram);
         _total_time = metrics._total_time;
         _total_operations = metrics._total_operations;
         _total_items = metrics._total_items;
         _total_bytes = metrics._total_bytes;
 
-        // Overwrite metrics custom tables
-        for (const auto& it : metrics._custom_int)
-            _custom_int[it.first] = it.second;
-        for (const auto& it : metrics._custom_uint)
-            _custom_uint[it.first] = it.second;
-        for (const auto& it : metrics._custom_int64)
-            _custom_int64[it.first] = it.second;
-        for (const auto& it : metrics._custom_uint64)
-            _custom_uint64[it.first] = it.second;
-        for (const auto& it : metrics._custom_flt)
-            _custom_flt[it.first] = it.second;
-        for (const auto& it : metrics._custom_dbl)
-            _custom_dbl[it.first] = it.second;
-        for (const auto& it : metrics._custom_str)
-            _custom_str[it.first] = it.second;
-
-        // Overwrite metrics threads value
-        _threads = metrics._threads;
+        // Overwrite other metrics values with the best attempt ones
+        AssignMetrics(metrics);
+        if (!combined)
+            AssignSamples(metrics);
     }
 }
 
 void PhaseMetrics::ResetMetrics() noexcept
 {
     FreeLatencyHistogram();
+    _latency_params = std::make_tuple(0, 0, 0);
+    _latency_attempts = false;
     _min_time = std::numeric_limits<int64_t>::max();
     _max_time = std::numeric_limits<int64_t>::min();
     _total_time = 0;
     _total_operations = 0;
     _total_items = 0;
     _total_bytes = 0;
+    _sampling_calls = 0;
     _iterstamp = 0;
     _timestamp = 0;
     _threads = 1;
+    _cpu = -1;
+    _running_start = 0;
+    _running_stop = 0;
+    _overlap = false;
+    _start_skew = 0;
+    _overlap_time = 0;
+    _overlap_operations = -1;
+    _overhead = false;
+    _overhead_time = 0;
+    _overhead_latency = 0;
+    _samples.clear();
+    _samples_capacity = 0;
+    _samples_reservoir = false;
+    _samples_thread = 0;
+    _samples_random = 0;
+    _total_samples = 0;
+    _interval_period = 0;
+    _interval_timestamp = 0;
+    _interval_operations = 0;
+    _interval_items = 0;
+    _interval_bytes = 0;
+    _interval_capacity = 0;
+    _intervals.clear();
+    _attempts.clear();
+    _attempt_metrics.clear();
+    _statistics = PhaseStatistics();
+    _fairness.clear();
+    _counters_group.reset();
+    _counters_mask = 0;
+    _counters.fill(0);
+    _counters_start.fill(0);
+    _resources = false;
+    _resource_usage = ResourceUsage();
+    _resource_usage_start = ResourceUsage();
+    _allocations = false;
+    _allocation_counters = AllocationCounters();
+    _allocation_start = AllocationCounters();
+}
+
+void PhaseMetrics::UpdateStatistics(AttemptSelection selection, double outliers)
+{
+    _statistics = PhaseStatistics();
+    if (_attempts.empty())
+        return;
+
+    // Get operations throughput of all attempts
+    std::vector<double> values;
+    values.reserve(_attempts.size());
+    for (const auto& attempt : _attempts)
+        values.push_back(attempt.operations_per_second());
+
+    // Reject outlier attempts
+    std::vector<bool> rejected(values.size(), false);
+    if (outliers > 0)
+        rejected = Statistics::Outliers(values, outliers);
+
+    // Collect accepted attempts
+    std::vector<double> accepted;
+    accepted.reserve(values.size());
+    for (size_t i = 0; i < _attempts.size(); ++i)
+    {
+        _attempts[i].rejected = rejected[i];
+        if (!rejected[i])
+            accepted.push_back(values[i]);
+        else
+            ++_statistics.rejected;
+    }
+
+    // Update throughput statistics
+    std::pair<double, double> ci = Statistics::BootstrapCI(accepted);
+    _statistics.attempts = (int)accepted.size();
+    _statistics.median = Statistics::Median(accepted);
+    _statistics.mean = Statistics::Mean(accepted);
+    _statistics.mad = Statistics::MAD(accepted);
+    _statistics.cv = Statistics::CV(accepted);
+    _statistics.ci_lower = ci.first;
+    _statistics.ci_upper = ci.second;
+
+    // Select the accepted attempt with the median throughput
+    if ((selection == AttemptSelection::Median) && !accepted.empty())
+    {
+        std::vector<size_t> indexes;
+        for (size_t i = 0; i < _attempts.size(); ++i)
+            if (!_attempts[i].rejected)
+                indexes.push_back(i);
+        std::sort(indexes.begin(), indexes.end(), [&values](size_t i1, size_t i2) { return values[i1] < values[i2]; });
+
+        size_t index = indexes[(indexes.size() - 1) / 2];
+        const PhaseAttempt& attempt = _attempts[index];
+        _total_time = attempt.total_time;
+        _total_operations = attempt.total_operations;
+        _total_items = attempt.total_items;
+        _total_bytes = attempt.total_bytes;
+
+        // Take other metrics values from the complete metrics of the selected attempt
+        if (_attempt_metrics.size() == _attempts.size())
+        {
+            const PhaseMetrics& metrics = *_attempt_metrics[index];
+            _min_time = metrics._min_time;
+            _max_time = metrics._max_time;
+            AssignMetrics(metrics);
+            AssignSamples(metrics);
+
+            // Replace combined latency with the latency of the selected attempt
+            if (metrics._histogram != nullptr)
+            {
+                if (_histogram != nullptr)
+                    hdr_reset((hdr_histogram*)_histogram);
+                Internals::AddLatencyHistogram(_histogram, metrics._histogram, metrics._latency_params);
+            }
+        }
+    }
 }
 
 } // namespace CppBenchmark
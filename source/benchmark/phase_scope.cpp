@@ -51,4 +51,14 @@ std::shared_ptr<PhaseScope> PhaseScope::ScopePhaseThreadSafe(const std::string&
     return _phase ? _phase->ScopePhaseThreadSafe(phase) : nullptr;
 }
 
+PhaseHandle PhaseScope::ResolvePhase(const std::string& phase)
+{
+    return _phase ? _phase->ResolvePhase(phase) : PhaseHandle();
+}
+
+PhaseHandle PhaseScope::ResolvePhaseThreadSafe(const std::string& phase)
+{
+    return _phase ? _phase->ResolvePhaseThreadSafe(phase) : PhaseHandle();
+}
+
 } // namespace CppBenchmark
@@ -51,46 +51,158 @@ void ReporterConsole::ReportBenchmark(const BenchmarkBase& benchmark, const Sett
 {
     _stream << Color::DARKGREY << GenerateSeparator('=') << std::endl;
     _stream << Color::WHITE << "Benchmark: " << Color::LIGHTCYAN << benchmark.name() << std::endl;
-    _stream << Color::WHITE << "Attempts: " << Color::DARKGREY << settings.attempts() << std::endl;
+    if (settings.adaptive())
+        _stream << Color::WHITE << "Attempts: " << Color::DARKGREY << settings.attempts() << " - " << settings.attempts_max() << " (precision: " << (100.0 * settings.attempts_precision()) << "%)" << std::endl;
+    else
+        _stream << Color::WHITE << "Attempts: " << Color::DARKGREY << settings.attempts() << std::endl;
+    _stream << Color::WHITE << "Clock: " << Color::DARKGREY << System::ClockName(benchmark.clock()) << " (" << GenerateClockSpeed(System::ClockFrequency(benchmark.clock())) << ")" << std::endl;
     if (settings.duration() > 0)
         _stream << Color::WHITE << "Duration: " << Color::DARKGREY << settings.duration() << " seconds" << std::endl;
     if (settings.operations() > 0)
         _stream << Color::WHITE << "Operations: " << Color::DARKGREY << settings.operations() << std::endl;
+    if (settings.warmup() > 0)
+        _stream << Color::WHITE << "Warmup: " << Color::DARKGREY << settings.warmup() << " operations" << std::endl;
+    if (settings.warmup_duration() > 0)
+        _stream << Color::WHITE << "Warmup: " << Color::DARKGREY << settings.warmup_duration() << " milliseconds" << std::endl;
+    if (settings.batched())
+        _stream << Color::WHITE << "Batch: " << Color::DARKGREY << ((settings.batch() > 0) ? std::to_string(settings.batch()) : "auto") << std::endl;
+    if (settings.rate() > 0)
+        _stream << Color::WHITE << "Rate: " << Color::DARKGREY << settings.rate() << " ops/s" << (settings.rate_poisson() ? " (Poisson)" : "") << std::endl;
+    if (settings.affinity() == AffinityPolicy::List)
+    {
+        _stream << Color::WHITE << "Affinity: " << Color::DARKGREY;
+        for (size_t i = 0; i < settings.affinity_cpus().size(); ++i)
+            _stream << ((i > 0) ? ", " : "") << settings.affinity_cpus()[i];
+        _stream << std::endl;
+    }
+    else if (settings.affinity() != AffinityPolicy::None)
+        _stream << Color::WHITE << "Affinity: " << Color::DARKGREY << Affinity::Name(settings.affinity()) << std::endl;
 }
 
 void ReporterConsole::ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics)
 {
     _stream << Color::DARKGREY << GenerateSeparator('-') << std::endl;
     _stream << Color::WHITE << "Phase: " << Color::LIGHTCYAN << phase.name() << std::endl;
+    if (metrics.cpu() >= 0)
+        _stream << Color::WHITE << "CPU: " << Color::DARKGREY << metrics.cpu() << std::endl;
     if (metrics.total_operations() > 1)
     {
         if (metrics.latency())
         {
-            _stream << Color::WHITE << "Latency (Min): " << Color::YELLOW << GenerateTimePeriod(metrics.min_latency()) << "/op" << std::endl;
-            _stream << Color::WHITE << "Latency (Max): " << Color::YELLOW << GenerateTimePeriod(metrics.max_latency()) << "/op" << std::endl;
-            _stream << Color::WHITE << "Latency (Mean): " << Color::YELLOW << metrics.mean_latency() << std::endl;
+            if (metrics.overhead())
+            {
+                _stream << Color::WHITE << "Latency (Min): " << Color::YELLOW << GenerateTimePeriod(metrics.min_latency()) << "/op" << Color::DARKGREY << " (corrected: " << GenerateTimePeriod(metrics.min_latency_corrected()) << "/op)" << std::endl;
+                _stream << Color::WHITE << "Latency (Max): " << Color::YELLOW << GenerateTimePeriod(metrics.max_latency()) << "/op" << Color::DARKGREY << " (corrected: " << GenerateTimePeriod(metrics.max_latency_corrected()) << "/op)" << std::endl;
+                _stream << Color::WHITE << "Latency (Mean): " << Color::YELLOW << metrics.mean_latency() << Color::DARKGREY << " (corrected: " << metrics.mean_latency_corrected() << ")" << std::endl;
+            }
+            else
+            {
+                _stream << Color::WHITE << "Latency (Min): " << Color::YELLOW << GenerateTimePeriod(metrics.min_latency()) << "/op" << std::endl;
+                _stream << Color::WHITE << "Latency (Max): " << Color::YELLOW << GenerateTimePeriod(metrics.max_latency()) << "/op" << std::endl;
+                _stream << Color::WHITE << "Latency (Mean): " << Color::YELLOW << metrics.mean_latency() << std::endl;
+            }
             _stream << Color::WHITE << "Latency (StDv): " << Color::YELLOW << metrics.stdv_latency() << std::endl;
+            _stream << Color::WHITE << "Latency (P50/P90/P99/P99.9): " << Color::YELLOW << GenerateTimePeriod(metrics.percentile_latency(50.0)) << " / " << GenerateTimePeriod(metrics.percentile_latency(90.0)) << " / " << GenerateTimePeriod(metrics.percentile_latency(99.0)) << " / " << GenerateTimePeriod(metrics.percentile_latency(99.9)) << std::endl;
         }
         else
         {
-            _stream << Color::WHITE << "Average time: " << Color::YELLOW << GenerateTimePeriod(metrics.avg_time()) << "/op" << std::endl;
-            _stream << Color::WHITE << "Minimal time: " << Color::YELLOW << GenerateTimePeriod(metrics.min_time()) << "/op" << std::endl;
-            _stream << Color::WHITE << "Maximal time: " << Color::YELLOW << GenerateTimePeriod(metrics.max_time()) << "/op" << std::endl;
+            if (metrics.overhead())
+            {
+                _stream << Color::WHITE << "Average time: " << Color::YELLOW << GenerateTimePeriod(metrics.avg_time()) << "/op" << Color::DARKGREY << " (corrected: " << GenerateTimePeriod(metrics.avg_time_corrected()) << "/op)" << std::endl;
+                _stream << Color::WHITE << "Minimal time: " << Color::YELLOW << GenerateTimePeriod(metrics.min_time()) << "/op" << Color::DARKGREY << " (corrected: " << GenerateTimePeriod(metrics.min_time_corrected()) << "/op)" << std::endl;
+                _stream << Color::WHITE << "Maximal time: " << Color::YELLOW << GenerateTimePeriod(metrics.max_time()) << "/op" << Color::DARKGREY << " (corrected: " << GenerateTimePeriod(metrics.max_time_corrected()) << "/op)" << std::endl;
+            }
+            else
+            {
+                _stream << Color::WHITE << "Average time: " << Color::YELLOW << GenerateTimePeriod(metrics.avg_time()) << "/op" << std::endl;
+                _stream << Color::WHITE << "Minimal time: " << Color::YELLOW << GenerateTimePeriod(metrics.min_time()) << "/op" << std::endl;
+                _stream << Color::WHITE << "Maximal time: " << Color::YELLOW << GenerateTimePeriod(metrics.max_time()) << "/op" << std::endl;
+            }
+        }
+        if (metrics.overhead())
+        {
+            _stream << Color::WHITE << "Harness overhead: " << Color::DARKGREY << GenerateTimePeriod(metrics.overhead_time()) << "/op" << std::endl;
+            if (metrics.latency())
+                _stream << Color::WHITE << "Harness overhead (Latency): " << Color::DARKGREY << GenerateTimePeriod(metrics.overhead_latency()) << "/op" << std::endl;
         }
     }
+    if (!metrics.samples().empty())
+        _stream << Color::WHITE << "Samples: " << Color::DARKGREY << metrics.samples().size() << " of " << metrics.total_samples() << std::endl;
     _stream << Color::WHITE << "Total time: " << Color::LIGHTRED << GenerateTimePeriod(metrics.total_time()) << std::endl;
     if (metrics.total_operations() > 1)
         _stream << Color::WHITE << "Total operations: " << Color::LIGHTGREEN << metrics.total_operations() << std::endl;
+    if (metrics.sampling())
+    {
+        _stream << Color::WHITE << "Total operations (estimated): " << Color::LIGHTGREEN << metrics.sampling_calls() << std::endl;
+        _stream << Color::WHITE << "Sampling rate: " << Color::DARKGREY << (100.0 * metrics.sampling_rate()) << "%" << std::endl;
+    }
     if (metrics.total_items() > 0)
         _stream << Color::WHITE << "Total items: " << Color::LIGHTMAGENTA << metrics.total_items() << std::endl;
     if (metrics.total_bytes() > 0)
         _stream << Color::WHITE << "Total bytes: " << Color::MAGENTA << GenerateDataSize(metrics.total_bytes()) << std::endl;
     if (metrics.total_operations() > 1)
         _stream << Color::WHITE << "Operations throughput: " << Color::LIGHTGREEN << metrics.operations_per_second() << " ops/s" << std::endl;
+    if ((metrics.total_operations() > 1) && ((metrics.statistics().attempts + metrics.statistics().rejected) > 1))
+    {
+        const PhaseStatistics& statistics = metrics.statistics();
+        _stream << Color::WHITE << "Attempts: " << Color::DARKGREY << statistics.attempts << " (rejected: " << statistics.rejected << ")" << std::endl;
+        _stream << Color::WHITE << "Throughput (Median): " << Color::LIGHTGREEN << (int64_t)statistics.median << " ops/s" << std::endl;
+        _stream << Color::WHITE << "Throughput (Mean): " << Color::LIGHTGREEN << (int64_t)statistics.mean << " ops/s" << std::endl;
+        _stream << Color::WHITE << "Throughput (MAD): " << Color::LIGHTGREEN << (int64_t)statistics.mad << " ops/s" << std::endl;
+        _stream << Color::WHITE << "Throughput (CV): " << Color::LIGHTGREEN << (statistics.cv * 100.0) << "%" << std::endl;
+        _stream << Color::WHITE << "Throughput (95% CI): " << Color::LIGHTGREEN << (int64_t)statistics.ci_lower << " - " << (int64_t)statistics.ci_upper << " ops/s" << std::endl;
+    }
+    if (metrics.overlap())
+    {
+        _stream << Color::WHITE << "Start skew: " << Color::DARKGREY << GenerateTimePeriod(metrics.start_skew()) << std::endl;
+        _stream << Color::WHITE << "Overlap window: " << Color::DARKGREY << GenerateTimePeriod(metrics.overlap_time()) << std::endl;
+        if (metrics.overlap_operations() >= 0)
+            _stream << Color::WHITE << "Operations throughput (overlap): " << Color::LIGHTGREEN << metrics.overlap_operations_per_second() << " ops/s" << std::endl;
+    }
+    for (const auto& fairness : metrics.fairness())
+    {
+        _stream << Color::WHITE << "Fairness (" << fairness.role << "s: " << fairness.threads << "): " << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Throughput (Min/Max): " << Color::GREY << (int64_t)fairness.min << " / " << (int64_t)fairness.max << " ops/s" << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Throughput (StDv): " << Color::GREY << (int64_t)fairness.stdv << " ops/s" << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Jain's index: " << Color::GREY << fairness.jain << std::endl;
+    }
     if (metrics.total_items() > 0)
         _stream << Color::WHITE << "Items throughput: " << Color::LIGHTMAGENTA << metrics.items_per_second() << " items/s" << std::endl;
     if (metrics.total_bytes() > 0)
         _stream << Color::WHITE << "Bytes throughput: " << Color::MAGENTA << GenerateDataSize(metrics.bytes_per_second()) << "/s" << std::endl;
+    if (metrics.counters())
+    {
+        _stream << Color::WHITE << "Performance counters: " << std::endl;
+        for (int i = 0; i < Counters::COUNT; ++i)
+        {
+            CounterType type = (CounterType)i;
+            if (metrics.counter_available(type))
+                _stream << Color::DARKGREY << '\t' << Counters::Name(type) << ": " << Color::GREY << metrics.counter(type) << Color::DARKGREY << " (" << metrics.counter_per_operation(type) << "/op)" << std::endl;
+        }
+        if (metrics.ipc() > 0)
+            _stream << Color::DARKGREY << '\t' << "ipc: " << Color::GREY << metrics.ipc() << std::endl;
+    }
+    if (metrics.allocations())
+    {
+        const AllocationCounters& counters = metrics.allocation_counters();
+        _stream << Color::WHITE << "Heap allocations: " << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Allocations: " << Color::GREY << counters.allocations << Color::DARKGREY << " (" << metrics.allocations_per_operation() << "/op)" << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Frees: " << Color::GREY << counters.frees << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Allocated bytes: " << Color::GREY << GenerateDataSize(counters.bytes) << Color::DARKGREY << " (" << metrics.allocated_bytes_per_operation() << " bytes/op)" << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Peak live bytes: " << Color::GREY << GenerateDataSize(counters.peak) << std::endl;
+    }
+    if (metrics.resources())
+    {
+        const ResourceUsage& usage = metrics.resource_usage();
+        _stream << Color::WHITE << "Resources usage: " << std::endl;
+        _stream << Color::DARKGREY << '\t' << "CPU time: " << Color::GREY << GenerateTimePeriod(usage.cpu_time) << Color::DARKGREY << " (utilization: " << (100.0 * metrics.cpu_utilization()) << "%)" << std::endl;
+        _stream << Color::DARKGREY << '\t' << "User time: " << Color::GREY << GenerateTimePeriod(usage.user_time) << std::endl;
+        _stream << Color::DARKGREY << '\t' << "System time: " << Color::GREY << GenerateTimePeriod(usage.system_time) << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Minor faults: " << Color::GREY << usage.minor_faults << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Major faults: " << Color::GREY << usage.major_faults << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Voluntary switches: " << Color::GREY << usage.voluntary_switches << std::endl;
+        _stream << Color::DARKGREY << '\t' << "Involuntary switches: " << Color::GREY << usage.involuntary_switches << std::endl;
+    }
     if ((metrics.custom_int().size() > 0) || (metrics.custom_uint().size() > 0) ||
         (metrics.custom_int64().size() > 0) || (metrics.custom_uint64().size() > 0) ||
         (metrics.custom_flt().size() > 0) || (metrics.custom_dbl().size() > 0) ||
@@ -12,7 +12,15 @@ namespace CppBenchmark {
 
 void ReporterCSV::ReportHeader()
 {
-    _stream << "name,avg_time,min_time,max_time,total_time,total_operations,total_items,total_bytes,operations_per_second,items_per_second,bytes_per_second\n";
+    _stream << "name,avg_time,min_time,max_time,total_time,total_operations,total_items,total_bytes,operations_per_second,items_per_second,bytes_per_second,clock,clock_frequency,overhead_time,overhead_latency,avg_time_corrected,min_time_corrected,max_time_corrected,min_latency_corrected,max_latency_corrected,mean_latency_corrected,attempts,rejected_attempts,operations_per_second_median,operations_per_second_mean,operations_per_second_mad,operations_per_second_cv,operations_per_second_ci_lower,operations_per_second_ci_upper";
+    for (int i = 0; i < Counters::COUNT; ++i)
+        _stream << ',' << Counters::Name((CounterType)i) << ',' << Counters::Name((CounterType)i) << "_per_operation";
+    _stream << ",ipc,cpu_time,user_time,system_time,cpu_utilization,minor_faults,major_faults,voluntary_switches,involuntary_switches,allocations,allocations_per_operation,frees,allocated_bytes,allocated_bytes_per_operation,peak_allocated_bytes,cpu,start_skew,overlap_time,overlap_operations_per_second,fairness_throughput_min,fairness_throughput_max,fairness_throughput_stdv,fairness_index,sampling_calls,sampling_rate\n";
+}
+
+void ReporterCSV::ReportBenchmark(const BenchmarkBase& benchmark, const Settings& settings)
+{
+    _clock = benchmark.clock();
 }
 
 void ReporterCSV::ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics)
@@ -42,7 +50,66 @@ void ReporterCSV::ReportPhase(const PhaseCore& phase, const PhaseMetrics& metric
     << metrics.total_bytes() << ','
     << metrics.operations_per_second() << ','
     << metrics.items_per_second() << ','
-    << metrics.bytes_per_second() << '\n';
+    << metrics.bytes_per_second() << ','
+    << System::ClockName(_clock) << ','
+    << System::ClockFrequency(_clock) << ','
+    << metrics.overhead_time() << ','
+    << metrics.overhead_latency() << ','
+    << metrics.avg_time_corrected() << ','
+    << metrics.min_time_corrected() << ','
+    << metrics.max_time_corrected() << ','
+    << metrics.min_latency_corrected() << ','
+    << metrics.max_latency_corrected() << ','
+    << metrics.mean_latency_corrected() << ','
+    << metrics.statistics().attempts << ','
+    << metrics.statistics().rejected << ','
+    << metrics.statistics().median << ','
+    << metrics.statistics().mean << ','
+    << metrics.statistics().mad << ','
+    << metrics.statistics().cv << ','
+    << metrics.statistics().ci_lower << ','
+    << metrics.statistics().ci_upper;
+
+    for (int i = 0; i < Counters::COUNT; ++i)
+        _stream << ',' << metrics.counter((CounterType)i) << ',' << metrics.counter_per_operation((CounterType)i);
+    _stream << ',' << metrics.ipc();
+
+    const ResourceUsage& usage = metrics.resource_usage();
+    _stream
+    << ',' << usage.cpu_time
+    << ',' << usage.user_time
+    << ',' << usage.system_time
+    << ',' << metrics.cpu_utilization()
+    << ',' << usage.minor_faults
+    << ',' << usage.major_faults
+    << ',' << usage.voluntary_switches
+    << ',' << usage.involuntary_switches;
+
+    const AllocationCounters& counters = metrics.allocation_counters();
+    _stream
+    << ',' << counters.allocations
+    << ',' << metrics.allocations_per_operation()
+    << ',' << counters.frees
+    << ',' << counters.bytes
+    << ',' << metrics.allocated_bytes_per_operation()
+    << ',' << counters.peak
+    << ',' << metrics.cpu()
+    << ',' << metrics.start_skew()
+    << ',' << metrics.overlap_time()
+    << ',' << metrics.overlap_operations_per_second();
+
+    // Report the least fair role of benchmark threads
+    PhaseFairness fairness = PhaseFairness();
+    for (const auto& item : metrics.fairness())
+        if ((fairness.threads == 0) || (item.jain < fairness.jain))
+            fairness = item;
+    _stream
+    << ',' << fairness.min
+    << ',' << fairness.max
+    << ',' << fairness.stdv
+    << ',' << fairness.jain
+    << ',' << metrics.sampling_calls()
+    << ',' << metrics.sampling_rate() << '\n';
 }
 
 } // namespace CppBenchmark
@@ -11,6 +11,7 @@
 #include "benchmark/environment.h"
 #include "benchmark/version.h"
 
+#include <algorithm>
 #include <set>
 
 namespace CppBenchmark {
@@ -96,10 +97,39 @@ void ReporterJSON::ReportBenchmark(const BenchmarkBase& benchmark, const Setting
 {
     _stream << Internals::indent4 << "\"name\": \"" << benchmark.name() << "\",\n";
     _stream << Internals::indent4 << "\"attempts\": " << settings.attempts() << ",\n";
+    if (settings.adaptive())
+    {
+        _stream << Internals::indent4 << "\"attempts_max\": " << settings.attempts_max() << ",\n";
+        _stream << Internals::indent4 << "\"attempts_precision\": " << settings.attempts_precision() << ",\n";
+    }
+    _stream << Internals::indent4 << "\"clock\": \"" << System::ClockName(benchmark.clock()) << "\",\n";
+    _stream << Internals::indent4 << "\"clock_frequency\": " << System::ClockFrequency(benchmark.clock()) << ",\n";
     if (settings.duration() > 0)
         _stream << Internals::indent4 << "\"duration\": " << settings.duration() << ",\n";
     if (settings.operations() > 0)
         _stream << Internals::indent4 << "\"operations\": " << settings.operations() << ",\n";
+    if (settings.warmup() > 0)
+        _stream << Internals::indent4 << "\"warmup\": " << settings.warmup() << ",\n";
+    if (settings.warmup_duration() > 0)
+        _stream << Internals::indent4 << "\"warmup_duration\": " << settings.warmup_duration() << ",\n";
+    if (settings.batched())
+        _stream << Internals::indent4 << "\"batch\": " << settings.batch() << ",\n";
+    if (settings.rate() > 0)
+    {
+        _stream << Internals::indent4 << "\"rate\": " << settings.rate() << ",\n";
+        _stream << Internals::indent4 << "\"rate_poisson\": " << (settings.rate_poisson() ? "true" : "false") << ",\n";
+    }
+    if (settings.affinity() != AffinityPolicy::None)
+    {
+        _stream << Internals::indent4 << "\"affinity\": \"" << Affinity::Name(settings.affinity()) << "\",\n";
+        if (settings.affinity() == AffinityPolicy::List)
+        {
+            _stream << Internals::indent4 << "\"affinity_cpus\": [";
+            for (size_t i = 0; i < settings.affinity_cpus().size(); ++i)
+                _stream << ((i > 0) ? ", " : "") << settings.affinity_cpus()[i];
+            _stream << "],\n";
+        }
+    }
 }
 
 void ReporterJSON::ReportPhasesHeader()
@@ -134,6 +164,8 @@ void ReporterJSON::ReportPhaseFooter()
 void ReporterJSON::ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics)
 {
     _stream << Internals::indent7 << "\"name\": \"" << phase.name() << "\",\n";
+    if (metrics.cpu() >= 0)
+        _stream << Internals::indent7 << "\"cpu\": " << metrics.cpu() << ",\n";
     if (metrics.total_operations() > 1)
     {
         if (metrics.latency())
@@ -142,6 +174,10 @@ void ReporterJSON::ReportPhase(const PhaseCore& phase, const PhaseMetrics& metri
             _stream << Internals::indent7 << "\"max_latency\": " << metrics.max_latency() << ",\n";
             _stream << Internals::indent7 << "\"mean_latency\": " << metrics.mean_latency() << ",\n";
             _stream << Internals::indent7 << "\"stdv_latency\": " << metrics.stdv_latency() << ",\n";
+            _stream << Internals::indent7 << "\"p50_latency\": " << metrics.percentile_latency(50.0) << ",\n";
+            _stream << Internals::indent7 << "\"p90_latency\": " << metrics.percentile_latency(90.0) << ",\n";
+            _stream << Internals::indent7 << "\"p99_latency\": " << metrics.percentile_latency(99.0) << ",\n";
+            _stream << Internals::indent7 << "\"p999_latency\": " << metrics.percentile_latency(99.9) << ",\n";
         }
         else
         {
@@ -149,6 +185,124 @@ void ReporterJSON::ReportPhase(const PhaseCore& phase, const PhaseMetrics& metri
             _stream << Internals::indent7 << "\"min_time\": " << metrics.min_time() << ",\n";
             _stream << Internals::indent7 << "\"max_time\": " << metrics.max_time() << ",\n";
         }
+        if (metrics.overhead())
+        {
+            if (metrics.latency())
+            {
+                _stream << Internals::indent7 << "\"min_latency_corrected\": " << metrics.min_latency_corrected() << ",\n";
+                _stream << Internals::indent7 << "\"max_latency_corrected\": " << metrics.max_latency_corrected() << ",\n";
+                _stream << Internals::indent7 << "\"mean_latency_corrected\": " << metrics.mean_latency_corrected() << ",\n";
+                _stream << Internals::indent7 << "\"overhead_latency\": " << metrics.overhead_latency() << ",\n";
+            }
+            else
+            {
+                _stream << Internals::indent7 << "\"avg_time_corrected\": " << metrics.avg_time_corrected() << ",\n";
+                _stream << Internals::indent7 << "\"min_time_corrected\": " << metrics.min_time_corrected() << ",\n";
+                _stream << Internals::indent7 << "\"max_time_corrected\": " << metrics.max_time_corrected() << ",\n";
+            }
+            _stream << Internals::indent7 << "\"overhead_time\": " << metrics.overhead_time() << ",\n";
+        }
+    }
+    if (!metrics.samples().empty())
+    {
+        // Sort samples in chronological order
+        std::vector<PhaseSample> samples(metrics.samples());
+        std::sort(samples.begin(), samples.end(), [](const PhaseSample& s1, const PhaseSample& s2) { return s1.timestamp < s2.timestamp; });
+
+        _stream << Internals::indent7 << "\"total_samples\": " << metrics.total_samples() << ",\n";
+        _stream << Internals::indent7 << "\"samples\": [";
+        bool comma = false;
+        for (const auto& sample : samples)
+        {
+            if (comma)
+                _stream << ',';
+            _stream << '\n' << Internals::indent8 << "{ \"timestamp\": " << sample.timestamp << ", \"duration\": " << sample.duration << ", \"operations\": " << sample.operations << ", \"thread\": " << sample.thread << " }";
+            comma = true;
+        }
+        _stream << '\n';
+        _stream << Internals::indent7 << "],\n";
+    }
+    if (metrics.sampling())
+    {
+        _stream << Internals::indent7 << "\"sampling_calls\": " << metrics.sampling_calls() << ",\n";
+        _stream << Internals::indent7 << "\"sampling_rate\": " << metrics.sampling_rate() << ",\n";
+    }
+    if (!metrics.attempts().empty())
+    {
+        const PhaseStatistics& statistics = metrics.statistics();
+        _stream << Internals::indent7 << "\"attempts\": " << statistics.attempts << ",\n";
+        _stream << Internals::indent7 << "\"rejected_attempts\": " << statistics.rejected << ",\n";
+        _stream << Internals::indent7 << "\"operations_per_second_median\": " << statistics.median << ",\n";
+        _stream << Internals::indent7 << "\"operations_per_second_mean\": " << statistics.mean << ",\n";
+        _stream << Internals::indent7 << "\"operations_per_second_mad\": " << statistics.mad << ",\n";
+        _stream << Internals::indent7 << "\"operations_per_second_cv\": " << statistics.cv << ",\n";
+        _stream << Internals::indent7 << "\"operations_per_second_ci_lower\": " << statistics.ci_lower << ",\n";
+        _stream << Internals::indent7 << "\"operations_per_second_ci_upper\": " << statistics.ci_upper << ",\n";
+    }
+    if (metrics.counters())
+    {
+        for (int i = 0; i < Counters::COUNT; ++i)
+        {
+            CounterType type = (CounterType)i;
+            if (metrics.counter_available(type))
+            {
+                _stream << Internals::indent7 << "\"" << Counters::Name(type) << "\": " << metrics.counter(type) << ",\n";
+                _stream << Internals::indent7 << "\"" << Counters::Name(type) << "_per_operation\": " << metrics.counter_per_operation(type) << ",\n";
+            }
+        }
+        if (metrics.ipc() > 0)
+            _stream << Internals::indent7 << "\"ipc\": " << metrics.ipc() << ",\n";
+    }
+    if (metrics.allocations())
+    {
+        const AllocationCounters& counters = metrics.allocation_counters();
+        _stream << Internals::indent7 << "\"allocations\": " << counters.allocations << ",\n";
+        _stream << Internals::indent7 << "\"allocations_per_operation\": " << metrics.allocations_per_operation() << ",\n";
+        _stream << Internals::indent7 << "\"frees\": " << counters.frees << ",\n";
+        _stream << Internals::indent7 << "\"allocated_bytes\": " << counters.bytes << ",\n";
+        _stream << Internals::indent7 << "\"allocated_bytes_per_operation\": " << metrics.allocated_bytes_per_operation() << ",\n";
+        _stream << Internals::indent7 << "\"peak_allocated_bytes\": " << counters.peak << ",\n";
+    }
+    if (metrics.resources())
+    {
+        const ResourceUsage& usage = metrics.resource_usage();
+        _stream << Internals::indent7 << "\"cpu_time\": " << usage.cpu_time << ",\n";
+        _stream << Internals::indent7 << "\"user_time\": " << usage.user_time << ",\n";
+        _stream << Internals::indent7 << "\"system_time\": " << usage.system_time << ",\n";
+        _stream << Internals::indent7 << "\"cpu_utilization\": " << metrics.cpu_utilization() << ",\n";
+        _stream << Internals::indent7 << "\"minor_faults\": " << usage.minor_faults << ",\n";
+        _stream << Internals::indent7 << "\"major_faults\": " << usage.major_faults << ",\n";
+        _stream << Internals::indent7 << "\"voluntary_switches\": " << usage.voluntary_switches << ",\n";
+        _stream << Internals::indent7 << "\"involuntary_switches\": " << usage.involuntary_switches << ",\n";
+    }
+    if ((metrics.running_start() > 0) || (metrics.running_stop() > 0))
+    {
+        _stream << Internals::indent7 << "\"running_start\": " << metrics.running_start() << ",\n";
+        _stream << Internals::indent7 << "\"running_stop\": " << metrics.running_stop() << ",\n";
+    }
+    if (!metrics.fairness().empty())
+    {
+        _stream << Internals::indent7 << "\"fairness\": [";
+        bool comma = false;
+        for (const auto& fairness : metrics.fairness())
+        {
+            if (comma)
+                _stream << ',';
+            _stream << '\n' << Internals::indent8 << "{ \"role\": \"" << fairness.role << "\", \"threads\": " << fairness.threads << ", \"min\": " << fairness.min << ", \"max\": " << fairness.max << ", \"mean\": " << fairness.mean << ", \"stdv\": " << fairness.stdv << ", \"jain\": " << fairness.jain << " }";
+            comma = true;
+        }
+        _stream << '\n';
+        _stream << Internals::indent7 << "],\n";
+    }
+    if (metrics.overlap())
+    {
+        _stream << Internals::indent7 << "\"start_skew\": " << metrics.start_skew() << ",\n";
+        _stream << Internals::indent7 << "\"overlap_time\": " << metrics.overlap_time() << ",\n";
+        if (metrics.overlap_operations() >= 0)
+        {
+            _stream << Internals::indent7 << "\"overlap_operations\": " << metrics.overlap_operations() << ",\n";
+            _stream << Internals::indent7 << "\"overlap_operations_per_second\": " << metrics.overlap_operations_per_second() << ",\n";
+        }
     }
     _stream << Internals::indent7 << "\"total_time\": " << metrics.total_time() << ",\n";
     if (metrics.total_operations() > 1)
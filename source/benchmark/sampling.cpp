@@ -0,0 +1,79 @@
+/*!
+    \file sampling.cpp
+    \brief Dynamic benchmarks sampling policy implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace CppBenchmark {
+
+Sampling Sampling::Every(int64_t calls) noexcept
+{
+    Sampling result;
+    result._type = SamplingType::Every;
+    result._every = std::max(calls, (int64_t)1);
+    return result;
+}
+
+Sampling Sampling::Probability(double probability) noexcept
+{
+    Sampling result;
+    result._type = SamplingType::Probability;
+    result._probability = std::clamp(probability, 0.0, 1.0);
+    return result;
+}
+
+Sampling Sampling::Budget(int64_t calls) noexcept
+{
+    Sampling result;
+    result._type = SamplingType::Budget;
+    result._budget = std::max(calls, (int64_t)1);
+    return result;
+}
+
+int64_t Sampling::Stride(uint64_t& random, int64_t calls, int64_t duration) const noexcept
+{
+    switch (_type)
+    {
+        case SamplingType::Every:
+            return _every;
+        case SamplingType::Probability:
+        {
+            if (_probability >= 1.0)
+                return 1;
+            if (_probability <= 0.0)
+                return std::numeric_limits<int64_t>::max();
+
+            // Uniform random value in (0, 1) from xorshift64* generator
+            random ^= random >> 12;
+            random ^= random << 25;
+            random ^= random >> 27;
+            double uniform = ((random * 2685821657736338717ull) >> 11) * (1.0 / 9007199254740992.0);
+            uniform = std::max(uniform, std::numeric_limits<double>::min());
+
+            // Geometric distribution of calls till the next sampled call
+            double stride = std::floor(std::log(uniform) / std::log1p(-_probability)) + 1.0;
+            return (stride < (double)std::numeric_limits<int64_t>::max()) ? (int64_t)stride : std::numeric_limits<int64_t>::max();
+        }
+        case SamplingType::Budget:
+        {
+            if (duration <= 0)
+                return std::max(calls, (int64_t)1);
+
+            // Spread the budget of sampled calls over the observed calls rate
+            double rate = (double)calls * 1000000000.0 / duration;
+            return std::max((int64_t)(rate / _budget), (int64_t)1);
+        }
+        default:
+            return 1;
+    }
+}
+
+} // namespace CppBenchmark
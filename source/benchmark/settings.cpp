@@ -8,15 +8,38 @@
 
 #include "benchmark/settings.h"
 
+#include <algorithm>
+
 namespace CppBenchmark {
 
 Settings::Settings()
     : _attempts(5),
+      _attempts_max(5),
+      _attempts_precision(0.0),
       _infinite(false),
       _duration(0),
       _operations(0),
+      _warmup(0),
+      _warmup_duration(0),
       _latency_params(std::make_tuple(0, 0, 0)),
-      _latency_auto(false)
+      _latency_auto(false),
+      _latency_attempts(false),
+      _clock(ClockType::Default),
+      _batched(false),
+      _batch(0),
+      _overhead(false),
+      _samples(0),
+      _samples_reservoir(false),
+      _intervals(0),
+      _intervals_capacity(64),
+      _selection(AttemptSelection::Best),
+      _outliers(0.0),
+      _counters(false),
+      _resources(false),
+      _affinity(AffinityPolicy::None),
+      _overlap(false),
+      _rate(0.0),
+      _rate_poisson(false)
 {
     Duration(0);
 }
@@ -30,6 +53,16 @@ Settings::Settings(int64_t operations)
 Settings& Settings::Attempts(int attempts)
 {
     _attempts = (attempts > 0) ? attempts : 5;
+    _attempts_max = _attempts;
+    _attempts_precision = 0.0;
+    return *this;
+}
+
+Settings& Settings::Attempts(int min, int max, double precision)
+{
+    _attempts = (min > 0) ? min : 5;
+    _attempts_max = std::max(max, _attempts);
+    _attempts_precision = (precision > 0) ? precision : 0.0;
     return *this;
 }
 
@@ -57,6 +90,20 @@ Settings& Settings::Duration(int64_t duration)
     return *this;
 }
 
+Settings& Settings::Warmup(int64_t operations)
+{
+    _warmup = (operations > 0) ? operations : 0;
+    _warmup_duration = 0;
+    return *this;
+}
+
+Settings& Settings::WarmupDuration(int64_t duration)
+{
+    _warmup = 0;
+    _warmup_duration = (duration > 0) ? duration : 0;
+    return *this;
+}
+
 Settings& Settings::Threads(int threads)
 {
     if (threads > 0)
@@ -337,4 +384,100 @@ Settings& Settings::Latency(int64_t lowest, int64_t highest, int significant, bo
     return *this;
 }
 
+Settings& Settings::LatencyAttempts()
+{
+    _latency_attempts = true;
+    return *this;
+}
+
+Settings& Settings::Clock(ClockType clock)
+{
+    _clock = clock;
+    return *this;
+}
+
+Settings& Settings::Batch(int64_t size)
+{
+    _batched = true;
+    _batch = (size > 0) ? size : 0;
+    return *this;
+}
+
+Settings& Settings::Overhead()
+{
+    _overhead = true;
+    return *this;
+}
+
+Settings& Settings::Samples(int64_t capacity, bool reservoir)
+{
+    _samples = (capacity > 0) ? capacity : 0;
+    _samples_reservoir = reservoir;
+    return *this;
+}
+
+Settings& Settings::Intervals(int64_t period, int64_t capacity)
+{
+    _intervals = (period > 0) ? period : 0;
+    _intervals_capacity = (capacity > 2) ? capacity : 2;
+    return *this;
+}
+
+Settings& Settings::Selection(AttemptSelection selection)
+{
+    _selection = selection;
+    return *this;
+}
+
+Settings& Settings::Outliers(double threshold)
+{
+    _outliers = (threshold > 0.0) ? threshold : 3.5;
+    return *this;
+}
+
+Settings& Settings::Counters()
+{
+    _counters = true;
+    return *this;
+}
+
+Settings& Settings::Resources()
+{
+    _resources = true;
+    return *this;
+}
+
+Settings& Settings::Affinity(AffinityPolicy policy)
+{
+    _affinity = policy;
+    if (policy != AffinityPolicy::List)
+        _affinity_cpus.clear();
+    return *this;
+}
+
+Settings& Settings::Affinity(const std::vector<int>& cpus)
+{
+    _affinity = cpus.empty() ? AffinityPolicy::None : AffinityPolicy::List;
+    _affinity_cpus = cpus;
+    return *this;
+}
+
+Settings& Settings::Overlap()
+{
+    _overlap = true;
+    return *this;
+}
+
+Settings& Settings::Rate(double rate, bool poisson)
+{
+    _rate = (rate > 0) ? rate : 0.0;
+    _rate_poisson = poisson;
+
+    // Open-loop latency requires the latency histogram
+    if ((_rate > 0) && (std::get<0>(_latency_params) == 0))
+        _latency_params = std::make_tuple(1, 60000000000, 3);
+
+    return *this;
+}
+
 } // namespace CppBenchmark
@@ -0,0 +1,133 @@
+/*!
+    \file statistics.cpp
+    \brief Statistics implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/statistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CppBenchmark {
+
+double Statistics::Mean(const std::vector<double>& values)
+{
+    if (values.empty())
+        return 0.0;
+
+    double sum = 0.0;
+    for (auto value : values)
+        sum += value;
+    return sum / values.size();
+}
+
+double Statistics::Median(const std::vector<double>& values)
+{
+    if (values.empty())
+        return 0.0;
+
+    std::vector<double> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t middle = sorted.size() / 2;
+    return ((sorted.size() % 2) != 0) ? sorted[middle] : ((sorted[middle - 1] + sorted[middle]) / 2.0);
+}
+
+double Statistics::StdDev(const std::vector<double>& values)
+{
+    if (values.size() < 2)
+        return 0.0;
+
+    double mean = Mean(values);
+    double sum = 0.0;
+    for (auto value : values)
+        sum += (value - mean) * (value - mean);
+    return std::sqrt(sum / (values.size() - 1));
+}
+
+double Statistics::MAD(const std::vector<double>& values)
+{
+    if (values.empty())
+        return 0.0;
+
+    double median = Median(values);
+    std::vector<double> deviations;
+    deviations.reserve(values.size());
+    for (auto value : values)
+        deviations.push_back(std::fabs(value - median));
+    return Median(deviations);
+}
+
+double Statistics::CV(const std::vector<double>& values)
+{
+    double mean = Mean(values);
+    return (mean != 0.0) ? (StdDev(values) / mean) : 0.0;
+}
+
+double Statistics::JainIndex(const std::vector<double>& values)
+{
+    double sum = 0.0;
+    double squares = 0.0;
+    for (auto value : values)
+    {
+        sum += value;
+        squares += value * value;
+    }
+    return (squares > 0.0) ? ((sum * sum) / (values.size() * squares)) : 0.0;
+}
+
+std::pair<double, double> Statistics::BootstrapCI(const std::vector<double>& values, double confidence, int resamples)
+{
+    if (values.empty())
+        return std::make_pair(0.0, 0.0);
+    if ((values.size() == 1) || (resamples <= 0))
+    {
+        double mean = Mean(values);
+        return std::make_pair(mean, mean);
+    }
+
+    // Fixed seed makes the bootstrap reproducible (xorshift64)
+    uint64_t random = 0x9E3779B97F4A7C15ull;
+
+    // Calculate means of resampled values
+    std::vector<double> means;
+    means.reserve(resamples);
+    for (int i = 0; i < resamples; ++i)
+    {
+        double sum = 0.0;
+        for (size_t j = 0; j < values.size(); ++j)
+        {
+            random ^= random << 13;
+            random ^= random >> 7;
+            random ^= random << 17;
+            sum += values[random % values.size()];
+        }
+        means.push_back(sum / values.size());
+    }
+    std::sort(means.begin(), means.end());
+
+    // Choose percentiles of resampled means
+    double alpha = (1.0 - std::clamp(confidence, 0.0, 1.0)) / 2.0;
+    size_t lower = (size_t)std::floor(alpha * (resamples - 1));
+    size_t upper = (size_t)std::ceil((1.0 - alpha) * (resamples - 1));
+    return std::make_pair(means[lower], means[upper]);
+}
+
+std::vector<bool> Statistics::Outliers(const std::vector<double>& values, double threshold)
+{
+    std::vector<bool> result(values.size(), false);
+
+    double median = Median(values);
+    double mad = MAD(values);
+    if (mad <= 0.0)
+        return result;
+
+    for (size_t i = 0; i < values.size(); ++i)
+        result[i] = ((0.6745 * std::fabs(values[i] - median) / mad) > threshold);
+    return result;
+}
+
+} // namespace CppBenchmark
@@ -11,20 +11,34 @@
 #if defined(__APPLE__)
 #include <mach/mach.h>
 #include <mach/mach_time.h>
+#include <sys/resource.h>
 #include <sys/sysctl.h>
 #include <math.h>
 #include <pthread.h>
 #elif defined(unix) || defined(__unix) || defined(__unix__)
 #include <pthread.h>
 #include <unistd.h>
+#include <sys/resource.h>
 #include <fstream>
 #include <regex>
 #include <set>
 #endif
+#if defined(linux) || defined(__linux) || defined(__linux__)
+#include <sched.h>
+#endif
 #if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <memory>
 #endif
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CPPBENCHMARK_TSC_SUPPORTED
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
 
 namespace CppBenchmark {
 
@@ -103,6 +117,88 @@ uint64_t PrepareTimebaseInfo(mach_timebase_info_data_t& tb)
 
 #endif
 
+//! Time-stamp counter calibration
+struct TSCCalibration
+{
+    //! Invariant time-stamp counter flag
+    bool invariant;
+    //! Time-stamp counter frequency in Hz
+    int64_t frequency;
+    //! Time-stamp counter value at the calibration point
+    uint64_t base_ticks;
+    //! Monotonic timestamp at the calibration point
+    uint64_t base_timestamp;
+    //! Nanoseconds per tick in 32.32 fixed-point format
+    uint64_t scale;
+};
+
+uint64_t ReadTSC()
+{
+#if defined(CPPBENCHMARK_TSC_SUPPORTED)
+    // Serialize the previous instructions before reading the counter
+    _mm_lfence();
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+bool DetectInvariantTSC()
+{
+#if defined(CPPBENCHMARK_TSC_SUPPORTED)
+    // CPUID.80000007H:EDX[8] is the invariant TSC flag
+#if defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 0x80000000);
+    if ((unsigned)info[0] < 0x80000007)
+        return false;
+    __cpuid(info, 0x80000007);
+    return (info[3] & (1 << 8)) != 0;
+#else
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0)
+        return false;
+    return (edx & (1 << 8)) != 0;
+#endif
+#else
+    return false;
+#endif
+}
+
+TSCCalibration CalibrateTSC()
+{
+    TSCCalibration result = { false, 0, 0, 0, 0 };
+
+    if (!DetectInvariantTSC())
+        return result;
+
+    // Measure time-stamp counter ticks during 20 milliseconds of the monotonic clock
+    uint64_t start_timestamp = System::Timestamp();
+    uint64_t start_ticks = ReadTSC();
+    uint64_t stop_timestamp = start_timestamp;
+    while ((stop_timestamp - start_timestamp) < 20000000)
+        stop_timestamp = System::Timestamp();
+    uint64_t stop_ticks = ReadTSC();
+
+    uint64_t ticks = stop_ticks - start_ticks;
+    uint64_t duration = stop_timestamp - start_timestamp;
+    if ((ticks == 0) || (duration == 0))
+        return result;
+
+    result.invariant = true;
+    result.frequency = (int64_t)System::MulDiv64(ticks, 1000000000, duration);
+    result.base_ticks = stop_ticks;
+    result.base_timestamp = stop_timestamp;
+    result.scale = System::MulDiv64(duration, 1ull << 32, ticks);
+    return result;
+}
+
+const TSCCalibration& GetTSCCalibration()
+{
+    static TSCCalibration calibration = CalibrateTSC();
+    return calibration;
+}
+
 #if defined(_WIN32) || defined(_WIN64)
 
 // Helper function to count set bits in the processor mask
@@ -123,6 +219,20 @@ DWORD CountSetBits(ULONG_PTR pBitMask)
 
 #endif
 
+#if defined(linux) || defined(__linux) || defined(__linux__)
+
+// Helper function to read the leading integer value from the sysfs file
+int ReadSysfsValue(const std::string& path, int value)
+{
+    std::ifstream stream(path);
+    int result;
+    if (stream >> result)
+        return result;
+    return value;
+}
+
+#endif
+
 } // namespace Internals
 //! @endcond
 
@@ -323,6 +433,129 @@ bool System::CpuHyperThreading()
     return (cores.first != cores.second);
 }
 
+bool System::CpuInvariantTSC()
+{
+    return Internals::GetTSCCalibration().invariant;
+}
+
+int64_t System::CpuTSCFrequency()
+{
+    return Internals::GetTSCCalibration().frequency;
+}
+
+std::vector<CpuTopology> System::CpuTopologies()
+{
+    std::vector<CpuTopology> result;
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        return result;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (!CPU_ISSET(cpu, &allowed))
+            continue;
+
+        std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+
+        CpuTopology topology;
+        topology.cpu = cpu;
+        topology.core = Internals::ReadSysfsValue(path + "/topology/core_id", cpu);
+        topology.package = Internals::ReadSysfsValue(path + "/topology/physical_package_id", 0);
+        topology.cache = -1;
+
+        // Find the highest cache level and take the first logical CPU sharing it as the cache Id
+        int level = 0;
+        for (int index = 0; ; ++index)
+        {
+            std::string cache = path + "/cache/index" + std::to_string(index);
+            int cache_level = Internals::ReadSysfsValue(cache + "/level", -1);
+            if (cache_level < 0)
+                break;
+            if (cache_level >= level)
+            {
+                level = cache_level;
+                topology.cache = Internals::ReadSysfsValue(cache + "/shared_cpu_list", cpu);
+            }
+        }
+
+        // Without cache information assume the cache is shared by the whole package
+        if (topology.cache < 0)
+            topology.cache = -1 - topology.package;
+
+        result.push_back(topology);
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    DWORD dwLength = 0;
+    GetLogicalProcessorInformation(nullptr, &dwLength);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+        return result;
+
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> buffer(dwLength / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+    if (!GetLogicalProcessorInformation(buffer.data(), &dwLength))
+        return result;
+
+    DWORD_PTR dwProcessMask, dwSystemMask;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &dwProcessMask, &dwSystemMask))
+        return result;
+
+    const int bits = sizeof(ULONG_PTR) * 8;
+    std::vector<CpuTopology> topologies(bits, CpuTopology{ -1, -1, 0, -1 });
+    int core = 0;
+    int package = 0;
+    int level = 0;
+
+    for (const auto& info : buffer)
+    {
+        // Find the lowest logical CPU of the processor mask
+        int first = 0;
+        while ((first < bits) && ((info.ProcessorMask & ((ULONG_PTR)1 << first)) == 0))
+            ++first;
+
+        for (int cpu = first; cpu < bits; ++cpu)
+        {
+            if ((info.ProcessorMask & ((ULONG_PTR)1 << cpu)) == 0)
+                continue;
+
+            switch (info.Relationship)
+            {
+                case RelationProcessorCore:
+                    topologies[cpu].cpu = cpu;
+                    topologies[cpu].core = core;
+                    break;
+                case RelationProcessorPackage:
+                    topologies[cpu].package = package;
+                    break;
+                case RelationCache:
+                    if (info.Cache.Level >= level)
+                        topologies[cpu].cache = first;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        if (info.Relationship == RelationProcessorCore)
+            ++core;
+        else if (info.Relationship == RelationProcessorPackage)
+            ++package;
+        else if ((info.Relationship == RelationCache) && (info.Cache.Level > level))
+            level = info.Cache.Level;
+    }
+
+    for (auto& topology : topologies)
+    {
+        if ((topology.cpu < 0) || ((dwProcessMask & ((DWORD_PTR)1 << topology.cpu)) == 0))
+            continue;
+        if (topology.cache < 0)
+            topology.cache = -1 - topology.package;
+        result.push_back(topology);
+    }
+#endif
+    return result;
+}
+
 int64_t System::RamTotal()
 {
 #if defined(__APPLE__)
@@ -396,6 +629,74 @@ uint64_t System::CurrentThreadId()
 #endif
 }
 
+ResourceUsage System::CurrentThreadResourceUsage()
+{
+    ResourceUsage result = {};
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    struct timespec cputime = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cputime);
+    result.cpu_time = (cputime.tv_sec * 1000000000) + cputime.tv_nsec;
+
+    struct rusage usage = {};
+#if defined(RUSAGE_THREAD)
+    getrusage(RUSAGE_THREAD, &usage);
+#else
+    getrusage(RUSAGE_SELF, &usage);
+#endif
+    result.user_time = (usage.ru_utime.tv_sec * 1000000000) + (usage.ru_utime.tv_usec * 1000);
+    result.system_time = (usage.ru_stime.tv_sec * 1000000000) + (usage.ru_stime.tv_usec * 1000);
+    result.minor_faults = usage.ru_minflt;
+    result.major_faults = usage.ru_majflt;
+    result.voluntary_switches = usage.ru_nvcsw;
+    result.involuntary_switches = usage.ru_nivcsw;
+#elif defined(_WIN32) || defined(_WIN64)
+    FILETIME creation, exit, kernel, user;
+    if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+    {
+        // FILETIME values are in 100-nanosecond intervals
+        result.user_time = (((uint64_t)user.dwHighDateTime << 32) | user.dwLowDateTime) * 100;
+        result.system_time = (((uint64_t)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime) * 100;
+        result.cpu_time = result.user_time + result.system_time;
+    }
+#endif
+    return result;
+}
+
+bool System::SetCurrentThreadAffinity(int cpu)
+{
+#if defined(linux) || defined(__linux) || defined(__linux__)
+    if (cpu >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cpu < 0)
+    {
+        // Affinity of the main thread is the process affinity
+        if (sched_getaffinity(getpid(), sizeof(set), &set) != 0)
+            return false;
+    }
+    else
+        CPU_SET(cpu, &set);
+    return (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+#elif defined(_WIN32) || defined(_WIN64)
+    if (cpu >= (int)(sizeof(DWORD_PTR) * 8))
+        return false;
+
+    DWORD_PTR dwMask = (DWORD_PTR)1 << ((cpu < 0) ? 0 : cpu);
+    if (cpu < 0)
+    {
+        DWORD_PTR dwSystemMask;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &dwMask, &dwSystemMask))
+            return false;
+    }
+    return (SetThreadAffinityMask(GetCurrentThread(), dwMask) != 0);
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
 uint64_t System::Timestamp()
 {
 #if defined(__APPLE__)
@@ -447,6 +748,48 @@ uint64_t System::Timestamp()
 #endif
 }
 
+uint64_t System::TimestampTSC()
+{
+    const Internals::TSCCalibration& calibration = Internals::GetTSCCalibration();
+    if (!calibration.invariant)
+        return Timestamp();
+
+    uint64_t ticks = Internals::ReadTSC() - calibration.base_ticks;
+
+    // Convert ticks to nanoseconds using 32.32 fixed-point scale
+#if defined(__GNUC__) && defined(__SIZEOF_INT128__)
+    return calibration.base_timestamp + (uint64_t)(((__uint128_t)ticks * calibration.scale) >> 32);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t high = 0;
+    uint64_t low = _umul128(ticks, calibration.scale, &high);
+    return calibration.base_timestamp + __shiftright128(low, high, 32);
+#else
+    return calibration.base_timestamp + MulDiv64(ticks, 1000000000, calibration.frequency);
+#endif
+}
+
+std::string System::ClockName(ClockType clock)
+{
+    switch (clock)
+    {
+        case ClockType::TSC:
+            return "tsc";
+        default:
+            return "monotonic";
+    }
+}
+
+int64_t System::ClockFrequency(ClockType clock)
+{
+    switch (clock)
+    {
+        case ClockType::TSC:
+            return CpuTSCFrequency();
+        default:
+            return 1000000000;
+    }
+}
+
 uint64_t System::MulDiv64(uint64_t operant, uint64_t multiplier, uint64_t divider)
 {
 #if defined(__GNUC__) && defined(__SIZEOF_INT128__)
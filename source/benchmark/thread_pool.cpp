@@ -0,0 +1,131 @@
+/*!
+    \file thread_pool.cpp
+    \brief Persistent benchmark worker threads pool implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/thread_pool.h"
+
+#include "benchmark/system.h"
+
+namespace CppBenchmark {
+
+ThreadPool::~ThreadPool()
+{
+    // Stop all worker threads
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _stop = true;
+        _start.notify_all();
+    }
+
+    // Wait for all worker threads
+    for (auto& worker : _workers)
+        worker->thread.join();
+}
+
+void ThreadPool::Run(const std::vector<int>& placement, const Task& task)
+{
+    int count = (int)placement.size();
+    if (count == 0)
+        return;
+
+    // Create missing worker threads waiting for the next run generation
+    while ((int)_workers.size() < count)
+    {
+        std::unique_ptr<Worker> worker(new Worker());
+        worker->cpu = -1;
+        Worker* current = worker.get();
+        int index = (int)_workers.size();
+        uint64_t generation = _generation;
+        worker->thread = std::thread([this, current, index, generation]() { Execute(current, index, generation); });
+        _workers.emplace_back(std::move(worker));
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // Start the next run generation
+    _placement = &placement;
+    _task = &task;
+    _count = count;
+    _pending = count;
+    ++_generation;
+    _start.notify_all();
+
+    // Wait for all participating worker threads
+    _finish.wait(lock, [this]() { return _pending == 0; });
+
+    _placement = nullptr;
+    _task = nullptr;
+    _count = 0;
+}
+
+void ThreadPool::Warmup(const std::vector<int>& placement)
+{
+    // Check for missing worker threads or changed placement
+    bool cold = (_workers.size() < placement.size());
+    for (size_t i = 0; !cold && (i < placement.size()); ++i)
+        cold = (_workers[i]->cpu != placement[i]);
+
+    // Create and bind worker threads with an empty run
+    if (cold)
+        Run(placement, [](int index, int cpu) {});
+}
+
+ThreadPool& ThreadPool::Default()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::Execute(Worker* worker, int index, uint64_t generation)
+{
+    for (;;)
+    {
+        int cpu;
+        const Task* task;
+
+        // Wait for the next run generation
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _start.wait(lock, [this, generation]() { return _stop || (_generation != generation); });
+            if (_stop)
+                return;
+            generation = _generation;
+
+            // Skip the run without the current worker
+            if (index >= _count)
+                continue;
+
+            cpu = (*_placement)[index];
+            task = _task;
+        }
+
+        // Update the worker affinity if the placement was changed
+        if (cpu != worker->cpu)
+        {
+            if ((cpu >= 0) && System::SetCurrentThreadAffinity(cpu))
+                worker->cpu = cpu;
+            else
+            {
+                if (worker->cpu >= 0)
+                    System::SetCurrentThreadAffinity(-1);
+                worker->cpu = -1;
+            }
+        }
+
+        // Run the task
+        (*task)(index, worker->cpu);
+
+        // Notify the last finished worker
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (--_pending == 0)
+                _finish.notify_one();
+        }
+    }
+}
+
+} // namespace CppBenchmark
@@ -0,0 +1,247 @@
+/*!
+    \file trace.cpp
+    \brief Phases timeline trace recorder implementation
+    \author CppBenchmark contributors
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "benchmark/trace.h"
+
+#include "benchmark/system.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace CppBenchmark {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Events buffer of the single thread
+struct TraceBuffer
+{
+    //! Thread Id
+    uint64_t thread;
+    //! Buffer capacity
+    size_t capacity;
+    //! Events buffer
+    std::unique_ptr<TraceEvent[]> events;
+    //! Count of published events (updated only by the owner thread)
+    std::atomic<size_t> size{0};
+};
+
+//! Trace recorder state
+struct TraceState
+{
+    //! Synchronization mutex
+    std::mutex mutex;
+    //! Capacity of new events buffers
+    size_t capacity = 0;
+    //! Registered phase names
+    std::vector<std::string> names;
+    //! Registered phase names index
+    std::unordered_map<std::string, uint32_t> index;
+    //! Events buffers of all threads
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+    //! Events buffers generation (incremented when buffers are cleared)
+    std::atomic<uint64_t> generation{1};
+    //! Count of dropped events
+    std::atomic<int64_t> dropped{0};
+};
+
+TraceState& GetTraceState()
+{
+    static TraceState state;
+    return state;
+}
+
+void WriteEscaped(std::ostream& stream, const std::string& value)
+{
+    for (char ch : value)
+    {
+        switch (ch)
+        {
+            case '"': stream << "\\\""; break;
+            case '\\': stream << "\\\\"; break;
+            case '\n': stream << "\\n"; break;
+            case '\r': stream << "\\r"; break;
+            case '\t': stream << "\\t"; break;
+            default:
+                if ((unsigned char)ch < 0x20)
+                {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned)ch);
+                    stream << buffer;
+                }
+                else
+                    stream << ch;
+                break;
+        }
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+std::atomic<bool> Trace::_enabled{false};
+
+int64_t Trace::dropped() noexcept
+{
+    return Internals::GetTraceState().dropped.load(std::memory_order_relaxed);
+}
+
+void Trace::Enable(size_t capacity)
+{
+    Internals::TraceState& state = Internals::GetTraceState();
+
+    std::scoped_lock lock(state.mutex);
+
+    state.capacity = std::max(capacity, (size_t)1);
+    _enabled.store(true, std::memory_order_relaxed);
+}
+
+void Trace::Disable() noexcept
+{
+    _enabled.store(false, std::memory_order_relaxed);
+}
+
+void Trace::Clear()
+{
+    Internals::TraceState& state = Internals::GetTraceState();
+
+    std::scoped_lock lock(state.mutex);
+
+    // Threads will register new events buffers with the next event
+    state.buffers.clear();
+    state.generation.fetch_add(1, std::memory_order_release);
+    state.dropped.store(0, std::memory_order_relaxed);
+}
+
+uint32_t Trace::Register(const std::string& name)
+{
+    Internals::TraceState& state = Internals::GetTraceState();
+
+    std::scoped_lock lock(state.mutex);
+
+    auto it = state.index.find(name);
+    if (it != state.index.end())
+        return it->second;
+
+    uint32_t result = (uint32_t)state.names.size();
+    state.names.emplace_back(name);
+    state.index.emplace(name, result);
+    return result;
+}
+
+void Trace::Record(uint32_t name, bool begin) noexcept
+{
+    thread_local std::shared_ptr<Internals::TraceBuffer> buffer;
+    thread_local uint64_t generation = 0;
+    // Count of recorded and dropped begin events which are not ended yet
+    thread_local size_t depth = 0;
+    thread_local size_t skipped = 0;
+
+    Internals::TraceState& state = Internals::GetTraceState();
+
+    // Register a new events buffer of the current thread once per generation
+    uint64_t current = state.generation.load(std::memory_order_acquire);
+    if (generation != current)
+    {
+        try
+        {
+            std::scoped_lock lock(state.mutex);
+
+            auto result = std::make_shared<Internals::TraceBuffer>();
+            result->thread = System::CurrentThreadId();
+            result->capacity = state.capacity;
+            result->events.reset(new TraceEvent[state.capacity]);
+            state.buffers.emplace_back(result);
+            buffer = result;
+            generation = current;
+            depth = 0;
+            skipped = 0;
+        }
+        catch (...)
+        {
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    size_t size = buffer->size.load(std::memory_order_relaxed);
+    if (begin)
+    {
+        // Drop the begin event if there is no room for it and for end events of all begun phases
+        if ((skipped > 0) || ((size + depth + 2) > buffer->capacity))
+        {
+            ++skipped;
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        ++depth;
+    }
+    else
+    {
+        // Drop the end event of the dropped or unknown begin event
+        if ((skipped > 0) || (depth == 0))
+        {
+            if (skipped > 0)
+                --skipped;
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        --depth;
+    }
+
+    // Publish the event
+    TraceEvent& event = buffer->events[size];
+    event.timestamp = System::Timestamp();
+    event.name = name;
+    event.begin = begin;
+    buffer->size.store(size + 1, std::memory_order_release);
+}
+
+void Trace::WriteJSON(std::ostream& stream)
+{
+    Internals::TraceState& state = Internals::GetTraceState();
+
+    std::scoped_lock lock(state.mutex);
+
+    // Find the first event timestamp to make timestamps relative
+    uint64_t origin = std::numeric_limits<uint64_t>::max();
+    for (const auto& buffer : state.buffers)
+        if (buffer->size.load(std::memory_order_acquire) > 0)
+            origin = std::min(origin, buffer->events[0].timestamp);
+
+    stream << "{\n  \"traceEvents\": [";
+
+    bool first = true;
+    for (const auto& buffer : state.buffers)
+    {
+        size_t size = buffer->size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const TraceEvent& event = buffer->events[i];
+
+            // Timestamps are in microseconds with nanoseconds fraction
+            uint64_t timestamp = event.timestamp - origin;
+            char ts[32];
+            std::snprintf(ts, sizeof(ts), "%llu.%03llu", (unsigned long long)(timestamp / 1000), (unsigned long long)(timestamp % 1000));
+
+            stream << (first ? "\n" : ",\n") << "    {\"name\":\"";
+            Internals::WriteEscaped(stream, (event.name < state.names.size()) ? state.names[event.name] : std::string());
+            stream << "\",\"cat\":\"phase\",\"ph\":\"" << (event.begin ? 'B' : 'E') << "\",\"ts\":" << ts << ",\"pid\":1,\"tid\":" << buffer->thread << "}";
+            first = false;
+        }
+    }
+
+    stream << "\n  ],\n  \"displayTimeUnit\": \"ns\"\n}\n";
+}
+
+} // namespace CppBenchmark
@@ -0,0 +1,37 @@
+//
+// Created by CppBenchmark contributors on 17.10.2026
+//
+
+#include "test.h"
+
+#include "benchmark/affinity.h"
+
+using namespace CppBenchmark;
+
+TEST_CASE("Affinity placement", "[CppBenchmark][Affinity]")
+{
+    // 4 physical cores with 2 SMT siblings each, 2 cores share one last level cache
+    std::vector<CpuTopology> topology;
+    for (int cpu = 0; cpu < 8; ++cpu)
+        topology.push_back(CpuTopology{ cpu, cpu % 4, 0, ((cpu % 4) < 2) ? 0 : 2 });
+
+    std::vector<int> none;
+
+    REQUIRE(Affinity::PlanThreads(AffinityPolicy::None, topology, none, 2) == std::vector<int>({ -1, -1 }));
+    REQUIRE(Affinity::PlanThreads(AffinityPolicy::Compact, topology, none, 4) == std::vector<int>({ 0, 4, 1, 5 }));
+    REQUIRE(Affinity::PlanThreads(AffinityPolicy::Scatter, topology, none, 6) == std::vector<int>({ 0, 2, 1, 3, 4, 6 }));
+    REQUIRE(Affinity::PlanThreads(AffinityPolicy::NoSMT, topology, none, 5) == std::vector<int>({ 0, 1, 2, 3, 0 }));
+    REQUIRE(Affinity::PlanThreads(AffinityPolicy::List, topology, { 7, 3 }, 3) == std::vector<int>({ 7, 3, 7 }));
+
+    REQUIRE(Affinity::PlanProducersConsumers(AffinityPolicy::SameCore, topology, none, 1, 1) == std::vector<int>({ 0, 4 }));
+    REQUIRE(Affinity::PlanProducersConsumers(AffinityPolicy::SameCache, topology, none, 2, 2) == std::vector<int>({ 0, 2, 1, 3 }));
+    REQUIRE(Affinity::PlanProducersConsumers(AffinityPolicy::DifferentCache, topology, none, 1, 2) == std::vector<int>({ 0, 2, 3 }));
+
+    REQUIRE(Affinity::PlanJobs(topology, 3, false) == std::vector<int>({ 0, 1, 2 }));
+    REQUIRE(Affinity::PlanJobs(topology, 3, true) == std::vector<int>({ 0, 2, 1 }));
+    REQUIRE(Affinity::PlanJobs(topology, 8, true) == std::vector<int>({ 0, 2, 1, 3 }));
+
+    // Unknown topology does not bind threads
+    REQUIRE(Affinity::PlanProducersConsumers(AffinityPolicy::SameCore, {}, none, 1, 1) == std::vector<int>({ -1, -1 }));
+    REQUIRE(Affinity::PlanJobs({}, 2, false) == std::vector<int>({ -1, -1 }));
+}
@@ -0,0 +1,72 @@
+//
+// Created by CppBenchmark contributors on 17.10.2026
+//
+
+#include "test.h"
+
+#include "benchmark/barrier.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppBenchmark;
+
+namespace {
+
+// Run the given count of threads through several barrier generations
+void TestBarrier(int threads, int64_t spin)
+{
+    const int generations = 100;
+
+    Barrier barrier(threads, spin);
+    std::atomic<int> arrived(0);
+    std::atomic<int> last(0);
+    std::atomic<int> errors(0);
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&]()
+        {
+            for (int generation = 0; generation < generations; ++generation)
+            {
+                ++arrived;
+                if (barrier.Wait())
+                    ++last;
+
+                // All threads must arrive before any of them leaves the barrier
+                if (arrived.load() < (generation + 1) * threads)
+                    ++errors;
+
+                // Wait for the next generation to keep arrivals counted per generation
+                barrier.Wait();
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    REQUIRE(errors.load() == 0);
+    REQUIRE(arrived.load() == generations * threads);
+    REQUIRE(last.load() == generations);
+}
+
+} // namespace
+
+TEST_CASE("Barrier single thread", "[CppBenchmark][Barrier]")
+{
+    Barrier barrier(1);
+    REQUIRE(barrier.Wait());
+    REQUIRE(barrier.Wait());
+}
+
+TEST_CASE("Barrier spinning threads", "[CppBenchmark][Barrier]")
+{
+    TestBarrier(4, 1024);
+}
+
+TEST_CASE("Barrier blocking threads", "[CppBenchmark][Barrier]")
+{
+    TestBarrier(4, 0);
+}
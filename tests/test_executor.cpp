@@ -0,0 +1,403 @@
+//
+// Created by CppBenchmark contributors on 17.10.2026
+//
+
+#include "test.h"
+
+#include "benchmark/cppbenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppBenchmark;
+
+namespace {
+
+class TestReporter : public Reporter
+{
+public:
+    std::vector<std::string> benchmarks;
+    std::vector<std::string> phases;
+
+    // Phases are qualified with the benchmark name, because the executor is shared by all tests
+    void ReportBenchmark(const BenchmarkBase& benchmark, const Settings& settings) override
+    { benchmarks.push_back(benchmark.name()); }
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    { phases.push_back(benchmarks.back() + "." + phase.name()); }
+};
+
+class WindowReporter : public Reporter
+{
+public:
+    std::string name;
+    int windows = 0;
+    int64_t operations = 0;
+
+    explicit WindowReporter(const std::string& benchmark) : name(benchmark) {}
+
+    void ReportHeader() override { ++windows; }
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    { if (phase.name() == name) operations += metrics.total_operations(); }
+};
+
+} // namespace
+
+TEST_CASE("Dynamic benchmark name hash", "[CppBenchmark][Executor]")
+{
+    static_assert(Executor::Hash("") == 14695981039346656037ull, "Hash of the empty name should be FNV-1a offset basis");
+    REQUIRE(Executor::Hash("Executor") == Executor::Hash(std::string("Executor")));
+    REQUIRE(Executor::Hash("Executor.1") != Executor::Hash("Executor.2"));
+}
+
+TEST_CASE("Dynamic benchmarks of several threads", "[CppBenchmark][Executor]")
+{
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([]()
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                auto benchmark = Executor::ScopeBenchmark("Executor.Threads");
+                auto phase = benchmark->ScopePhase("Phase");
+            }
+            Executor::StartBenchmark("Executor.Threads.StartStop");
+            Executor::StopBenchmark("Executor.Threads.StartStop");
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    TestReporter reporter;
+    Executor::Report(reporter);
+
+    REQUIRE(std::count(reporter.benchmarks.begin(), reporter.benchmarks.end(), "Executor.Threads") == 1);
+    REQUIRE(std::count(reporter.benchmarks.begin(), reporter.benchmarks.end(), "Executor.Threads.StartStop") == 1);
+    REQUIRE(std::count(reporter.phases.begin(), reporter.phases.end(), "Executor.Threads.Phase") == 1);
+}
+
+TEST_CASE("Dynamic benchmark phase handles", "[CppBenchmark][Executor]")
+{
+    PhaseHandle benchmark = Executor::ResolveBenchmark("Executor.Handles", Executor::Hash("Executor.Handles"));
+    PhaseHandle phase = benchmark.ResolvePhase("Phase");
+    PhaseHandle nested = phase.ResolvePhase("Nested");
+    REQUIRE(benchmark);
+    REQUIRE(phase.name() == "Phase");
+    REQUIRE(nested.name() == "Nested");
+    REQUIRE(!PhaseHandle());
+    REQUIRE(PhaseHandle().name() == "<none>");
+
+    for (int i = 0; i < 10; ++i)
+    {
+        auto benchmark_scope = benchmark.Scope();
+        auto phase_scope = phase.Scope();
+        for (int j = 0; j < 10; ++j)
+        {
+            PhaseHandleScope nested_scope(nested);
+        }
+    }
+
+    // Legacy API should resolve the same phases
+    {
+        auto scope = Executor::ScopeBenchmark("Executor.Handles");
+        REQUIRE(scope->ResolvePhase("Phase").name() == "Phase");
+        scope->StartPhase("Phase")->StopPhase();
+    }
+
+    REQUIRE(nested.metrics().total_operations() == 0);
+
+    TestReporter reporter;
+    Executor::Report(reporter);
+
+    REQUIRE(std::count(reporter.benchmarks.begin(), reporter.benchmarks.end(), "Executor.Handles") == 1);
+    REQUIRE(nested.metrics().total_operations() == 100);
+    REQUIRE(phase.metrics().total_operations() == 11);
+}
+
+TEST_CASE("Dynamic benchmark macros evaluate the name once", "[CppBenchmark][Executor]")
+{
+    int evaluations = 0;
+    auto name = [&evaluations]() { ++evaluations; return std::string("Executor.Macros"); };
+
+    for (int i = 0; i < 10; ++i)
+    {
+        {
+            auto scope = BENCHCODE_SCOPE(name());
+        }
+        BENCHCODE_START(name());
+        BENCHCODE_STOP(name());
+    }
+
+    REQUIRE(evaluations == 30);
+    REQUIRE(Executor::ResolveBenchmark("Executor.Macros", Executor::Hash("Executor.Macros")).metrics().total_operations() == 0);
+
+    TestReporter reporter;
+    Executor::Report(reporter);
+
+    REQUIRE(Executor::ResolveBenchmark("Executor.Macros", Executor::Hash("Executor.Macros")).metrics().total_operations() == 20);
+}
+
+TEST_CASE("Dynamic benchmarks with colliding name hashes", "[CppBenchmark][Executor]")
+{
+    PhaseHandle benchmark1 = Executor::ResolveBenchmark("Executor.Collision.1", 1);
+    PhaseHandle benchmark2 = Executor::ResolveBenchmark("Executor.Collision.2", 1);
+    REQUIRE(benchmark1.name() == "Executor.Collision.1");
+    REQUIRE(benchmark2.name() == "Executor.Collision.2");
+    REQUIRE(Executor::ResolveBenchmark("Executor.Collision.2", 1).name() == "Executor.Collision.2");
+
+    for (int i = 0; i < 10; ++i)
+    {
+        Executor::StartBenchmark("Executor.Collision.2", 1);
+        Executor::StopBenchmark("Executor.Collision.2", 1);
+    }
+
+    TestReporter reporter;
+    Executor::Report(reporter);
+
+    REQUIRE(benchmark1.metrics().total_operations() == 0);
+    REQUIRE(benchmark2.metrics().total_operations() == 10);
+}
+
+TEST_CASE("Dynamic benchmarks report of live threads", "[CppBenchmark][Executor]")
+{
+    std::atomic<int> step(0);
+
+    std::thread thread([&step]()
+    {
+        PhaseHandle benchmark = Executor::ResolveBenchmark("Executor.Live", Executor::Hash("Executor.Live"));
+        for (int i = 0; i < 100; ++i)
+            auto scope = benchmark.Scope();
+        step = 1;
+
+        // Publish metrics requested by the report at the next start
+        while (step != 2)
+            std::this_thread::yield();
+        auto scope = benchmark.Scope();
+        step = 3;
+
+        while (step != 4)
+            std::this_thread::yield();
+    });
+
+    // Metrics of the live thread are not published yet
+    while (step != 1)
+        std::this_thread::yield();
+    WindowReporter reporter1("Executor.Live");
+    Executor::Report(reporter1);
+    REQUIRE(reporter1.operations == 0);
+
+    // Metrics of the live thread are published at the next start
+    step = 2;
+    while (step != 3)
+        std::this_thread::yield();
+    WindowReporter reporter2("Executor.Live");
+    Executor::Report(reporter2);
+    REQUIRE(reporter2.operations == 100);
+
+    step = 4;
+    thread.join();
+}
+
+TEST_CASE("Dynamic benchmarks sampling policy", "[CppBenchmark][Executor]")
+{
+    uint64_t random = 0x123456789ABCDEFull;
+
+    REQUIRE(Sampling().type() == SamplingType::None);
+    REQUIRE(Sampling::Every(10).Stride(random, 10, 1000) == 10);
+    REQUIRE(Sampling::Every(0).every() == 1);
+    REQUIRE(Sampling::Probability(1.0).Stride(random, 1, 1000) == 1);
+
+    // Mean stride of the probability policy is the inverse probability
+    Sampling probability = Sampling::Probability(0.01);
+    int64_t strides = 0;
+    for (int i = 0; i < 10000; ++i)
+        strides += probability.Stride(random, 1, 0);
+    REQUIRE(strides / 10000.0 == Approx(100.0).epsilon(0.1));
+
+    // 1000000 calls per second with the budget of 1000 sampled calls per second
+    REQUIRE(Sampling::Budget(1000).Stride(random, 1000, 1000000) == 1000);
+    REQUIRE(Sampling::Budget(1000).Stride(random, 1, 1000000000) == 1);
+}
+
+TEST_CASE("Dynamic benchmarks sampling", "[CppBenchmark][Executor]")
+{
+    Executor::SetSampling("Executor.Sampling", Sampling::Every(10));
+
+    PhaseHandle benchmark = Executor::ResolveBenchmark("Executor.Sampling", Executor::Hash("Executor.Sampling"));
+    PhaseHandle phase = benchmark.ResolvePhase("Phase");
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto benchmark_scope = benchmark.Scope();
+        auto phase_scope = phase.Scope();
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        BENCHCODE_START("Executor.Sampling");
+        BENCHCODE_STOP("Executor.Sampling");
+    }
+
+    TestReporter reporter;
+    Executor::Report(reporter);
+
+    REQUIRE(benchmark.metrics().sampling());
+    REQUIRE(benchmark.metrics().sampling_calls() == 2000);
+    REQUIRE(benchmark.metrics().total_operations() == 200);
+    REQUIRE(benchmark.metrics().sampling_rate() == Approx(0.1));
+    REQUIRE(phase.metrics().sampling_calls() == 1000);
+    REQUIRE(phase.metrics().total_operations() == 100);
+}
+
+TEST_CASE("Dynamic benchmarks macro handles", "[CppBenchmark][Executor]")
+{
+    Executor::SetSampling("Executor.Macro.1", Sampling::Every(10));
+
+    // Dynamic benchmark of the scope macro is resolved once and manages its child phases
+    for (int i = 0; i < 100; ++i)
+    {
+        auto benchmark = BENCHCODE_SCOPE("Executor.Macro.1");
+        benchmark->StartPhase("Phase")->StopPhase();
+    }
+
+    // Dynamic benchmarks with names changed at the same call site are resolved again
+    for (int i = 0; i < 100; ++i)
+    {
+        std::string name = ((i % 2) == 0) ? "Executor.Macro.1" : "Executor.Macro.2";
+        BENCHCODE_START(name);
+        BENCHCODE_STOP(name);
+    }
+
+    TestReporter reporter;
+    Executor::Report(reporter);
+
+    PhaseHandle benchmark1 = Executor::ResolveBenchmark("Executor.Macro.1", Executor::Hash("Executor.Macro.1"));
+    PhaseHandle benchmark2 = Executor::ResolveBenchmark("Executor.Macro.2", Executor::Hash("Executor.Macro.2"));
+    REQUIRE(benchmark1.metrics().sampling_calls() == 150);
+    REQUIRE(benchmark1.metrics().total_operations() == 15);
+    REQUIRE(benchmark2.metrics().total_operations() == 50);
+    REQUIRE(benchmark1.ResolvePhase("Phase").metrics().total_operations() == 10);
+}
+
+TEST_CASE("Dynamic benchmarks background reporting", "[CppBenchmark][Executor]")
+{
+    auto reporter = std::make_shared<WindowReporter>("Executor.Reporting");
+    Executor::StartReporting(reporter, 10);
+
+    std::thread thread([]()
+    {
+        PhaseHandle benchmark = Executor::ResolveBenchmark("Executor.Reporting", Executor::Hash("Executor.Reporting"));
+        for (int i = 0; i < 10; ++i)
+        {
+            for (int j = 0; j < 100; ++j)
+                auto scope = benchmark.Scope();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    });
+    thread.join();
+
+    Executor::StopReporting();
+
+    // Metrics of the finished thread are reported with the last window
+    REQUIRE(reporter->windows > 1);
+    REQUIRE(reporter->operations == 1000);
+
+    // Registry of the finished thread is dropped after its last window
+    TestReporter results;
+    Executor::Report(results);
+    REQUIRE(std::count(results.benchmarks.begin(), results.benchmarks.end(), "Executor.Reporting") == 0);
+}
+
+TEST_CASE("Dynamic benchmarks report after background reporting", "[CppBenchmark][Executor]")
+{
+    auto reporter = std::make_shared<WindowReporter>("Executor.Reported");
+    Executor::StartReporting(reporter, 10000);
+
+    std::atomic<int> step(0);
+
+    std::thread thread([&step]()
+    {
+        PhaseHandle benchmark = Executor::ResolveBenchmark("Executor.Reported", Executor::Hash("Executor.Reported"));
+        for (int i = 0; i < 100; ++i)
+            auto scope = benchmark.Scope();
+        step = 1;
+
+        for (int i = 2; i <= 4; i += 2)
+        {
+            while (step != i)
+                std::this_thread::yield();
+            auto scope = benchmark.Scope();
+            step = i + 1;
+        }
+
+        while (step != 6)
+            std::this_thread::yield();
+    });
+
+    while (step != 1)
+        std::this_thread::yield();
+    Executor::StopReporting();
+
+    // Operations after the last window are not lost
+    step = 2;
+    while (step != 3)
+        std::this_thread::yield();
+    WindowReporter reporter1("Executor.Reported");
+    Executor::Report(reporter1);
+    step = 4;
+    while (step != 5)
+        std::this_thread::yield();
+    WindowReporter reporter2("Executor.Reported");
+    Executor::Report(reporter2);
+
+    REQUIRE(reporter->operations + reporter1.operations + reporter2.operations == 101);
+
+    step = 6;
+    thread.join();
+}
+
+TEST_CASE("Dynamic benchmarks shared memory export", "[CppBenchmark][Executor]")
+{
+    const std::string path = "cppbenchmark-tests.metrics";
+
+    REQUIRE(Executor::Export(path, 16));
+    REQUIRE(!Executor::Export(path, 16));
+
+    std::thread thread([]()
+    {
+        PhaseHandle benchmark = Executor::ResolveBenchmark("Executor.Export", Executor::Hash("Executor.Export"));
+        PhaseHandle phase = benchmark.ResolvePhase("Phase");
+        for (int i = 0; i < 100; ++i)
+        {
+            auto benchmark_scope = benchmark.Scope();
+            auto phase_scope = phase.Scope();
+        }
+    });
+    thread.join();
+
+    // Read exported metrics as an external reader
+    MetricsExport metrics;
+    REQUIRE(metrics.Open(path));
+    REQUIRE(metrics.capacity() == 16);
+    REQUIRE(metrics.count() == 2);
+
+    ExportMetrics benchmark;
+    REQUIRE(metrics.Read(0, benchmark));
+    REQUIRE(benchmark.name == "Executor.Export");
+    REQUIRE(benchmark.calls == 100);
+    REQUIRE(benchmark.operations == 100);
+    REQUIRE(benchmark.min_latency <= benchmark.max_latency);
+    REQUIRE(ExportMetrics::Percentile(benchmark.buckets, 50.0) <= ExportMetrics::Percentile(benchmark.buckets, 100.0));
+
+    ExportMetrics phase;
+    REQUIRE(metrics.Read(1, phase));
+    REQUIRE(phase.name == "Executor.Export.Phase");
+    REQUIRE(phase.operations == 100);
+    REQUIRE(!metrics.Read(2, phase));
+
+    metrics.Close();
+    std::remove(path.c_str());
+}
@@ -9,9 +9,17 @@
 #include "benchmark/reporter_csv.h"
 #include "benchmark/reporter_json.h"
 
+#include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <set>
 #include <sstream>
+#include <string>
 #include <thread>
+#include <vector>
 
 using namespace CppBenchmark;
 
@@ -74,6 +82,355 @@ private:
     int _cleanups;
 };
 
+class TestConvergenceBenchmark : public BenchmarkThreads
+{
+public:
+    explicit TestConvergenceBenchmark(const std::string& name, const Settings& settings = Settings())
+        : BenchmarkThreads(name, settings),
+          _launches(0),
+          _operations(0)
+    {
+    }
+
+    int launches() const { return _launches; }
+
+protected:
+    void Initialize(ContextThreads& context) override
+    {
+        // Odd and even launches make very different count of operations
+        _operations = ((++_launches % 2) == 0) ? 10 : 1000;
+    }
+    void InitializeThread(ContextThreads& context) override
+    {
+        // Launch time is nearly constant regardless of operations count
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    void RunThread(ContextThreads& context) override
+    {
+        if (--_operations <= 0)
+            context.Cancel();
+    }
+
+private:
+    int _launches;
+    std::atomic<int> _operations;
+};
+
+class TestPacedBenchmark : public Benchmark
+{
+public:
+    explicit TestPacedBenchmark(const std::string& name, const Settings& settings, int sleep)
+        : Benchmark(name, settings),
+          _sleep(sleep),
+          _runs(0)
+    {
+    }
+
+    int runs() const { return _runs; }
+
+protected:
+    void Run(Context& context) override
+    {
+        if (_sleep > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(_sleep));
+        _runs++;
+    }
+
+private:
+    int _sleep;
+    int _runs;
+};
+
+class TestMedianBenchmark : public Benchmark
+{
+public:
+    explicit TestMedianBenchmark(const std::string& name, const Settings& settings)
+        : Benchmark(name, settings),
+          _attempt(0)
+    {
+    }
+
+protected:
+    void Initialize(Context& context) override { ++_attempt; }
+    void Run(Context& context) override
+    {
+        // Each attempt has its own operation time: 1, 9, 5, 3, 7 milliseconds
+        static const int sleeps[] = { 1, 9, 5, 3, 7 };
+        std::this_thread::sleep_for(std::chrono::milliseconds(sleeps[(_attempt - 1) % 5]));
+        context.metrics().SetCustom("attempt", _attempt);
+    }
+
+private:
+    int _attempt;
+};
+
+class TestMedianReporter : public Reporter
+{
+public:
+    int64_t operations = 0;
+    int attempt = 0;
+    int64_t min_time = 0;
+    int64_t max_time = 0;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report metrics of the root phase
+        if (phase.name().find('.') == std::string::npos)
+        {
+            operations = metrics.total_operations();
+            attempt = metrics.custom_int().at("attempt");
+            min_time = metrics.min_time();
+            max_time = metrics.max_time();
+        }
+    }
+};
+
+class TestAllocationsBenchmark : public BenchmarkThreads
+{
+public:
+    explicit TestAllocationsBenchmark(const std::string& name, const Settings& settings)
+        : BenchmarkThreads(name, settings)
+    {
+    }
+
+protected:
+    void RunThread(ContextThreads& context) override
+    {
+        Allocations::Deallocate(Allocations::Allocate(64));
+    }
+};
+
+int new_handler_calls = 0;
+
+void TestNewHandler()
+{
+    // Give up after the first call
+    ++new_handler_calls;
+    std::set_new_handler(nullptr);
+}
+
+class TestAllocationsReporter : public Reporter
+{
+public:
+    AllocationCounters counters = { 0, 0, 0, 0, 0 };
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report heap allocations of the root phase
+        if (phase.name().find('.') == std::string::npos)
+            counters = metrics.allocation_counters();
+    }
+};
+
+class TestPCBenchmark : public BenchmarkPC
+{
+public:
+    explicit TestPCBenchmark(const std::string& name, const Settings& settings)
+        : BenchmarkPC(name, settings),
+          _operations(settings.operations()),
+          _available(0),
+          _consumed(0)
+    {
+    }
+
+protected:
+    void RunProducer(ContextPC& context) override { ++_available; }
+    void RunConsumer(ContextPC& context) override
+    {
+        // Consume produced items until all of them are consumed
+        int64_t available = _available.load();
+        if ((available > 0) && _available.compare_exchange_weak(available, available - 1))
+            ++_consumed;
+        else if (_consumed.load() >= _operations)
+            context.StopConsume();
+    }
+
+private:
+    int64_t _operations;
+    std::atomic<int64_t> _available;
+    std::atomic<int64_t> _consumed;
+};
+
+class TestLatencyReporter : public Reporter
+{
+public:
+    bool latency = false;
+    size_t intervals = 0;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report latency and interval snapshots of the root phase
+        if (phase.name().find('.') == std::string::npos)
+        {
+            latency = metrics.latency();
+            intervals = metrics.intervals().size();
+        }
+    }
+};
+
+class TestIntervalsReporter : public Reporter
+{
+public:
+    int64_t operations = 0;
+    std::vector<PhaseInterval> intervals;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report interval snapshots of the root phase
+        if (phase.name().find('.') == std::string::npos)
+        {
+            operations = metrics.total_operations();
+            intervals = metrics.intervals();
+        }
+    }
+};
+
+class TestFairnessBenchmark : public BenchmarkThreads
+{
+public:
+    explicit TestFairnessBenchmark(const std::string& name, const Settings& settings)
+        : BenchmarkThreads(name, settings),
+          _launches(0)
+    {
+    }
+
+protected:
+    void Initialize(ContextThreads& context) override { ++_launches; }
+    void RunThread(ContextThreads& context) override
+    {
+        // The slow thread is switched in each launch
+        bool first = (context.name() == "thread-0");
+        if (first == ((_launches % 2) == 0))
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+private:
+    std::atomic<int> _launches;
+};
+
+class TestFairnessReporter : public Reporter
+{
+public:
+    std::vector<PhaseFairness> fairness;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report threads fairness of the root phase
+        if (phase.name().find('.') == std::string::npos)
+            fairness = metrics.fairness();
+    }
+};
+
+class TestRunningReporter : public Reporter
+{
+public:
+    int threads = 0;
+    int64_t running = 0;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report the longest running time of benchmark threads
+        if (phase.name().find(".thread-") != std::string::npos)
+        {
+            ++threads;
+            running = std::max(running, metrics.running_stop() - metrics.running_start());
+        }
+    }
+};
+
+class TestSamplesReporter : public Reporter
+{
+public:
+    int64_t total = 0;
+    std::vector<PhaseSample> samples;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report samples of the root phase
+        if (phase.name().find('.') == std::string::npos)
+        {
+            total = metrics.total_samples();
+            samples = metrics.samples();
+        }
+    }
+};
+
+class TestSpinBenchmark : public BenchmarkThreads
+{
+public:
+    explicit TestSpinBenchmark(const std::string& name, const Settings& settings)
+        : BenchmarkThreads(name, settings)
+    {
+    }
+
+protected:
+    void RunThread(ContextThreads& context) override
+    {
+        // Spin for 2 milliseconds to consume CPU time
+        auto start = std::chrono::steady_clock::now();
+        while ((std::chrono::steady_clock::now() - start) < std::chrono::milliseconds(2));
+    }
+};
+
+class TestResourcesReporter : public Reporter
+{
+public:
+    ResourceUsage root = {};
+    ResourceUsage threads = {};
+    int count = 0;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report resources usage of the root phase and the sum of its threads
+        if (!metrics.resources())
+            return;
+        if (phase.name().find('.') == std::string::npos)
+            root = metrics.resource_usage();
+        else if (phase.name().find(".thread-") != std::string::npos)
+        {
+            ++count;
+            threads.cpu_time += metrics.resource_usage().cpu_time;
+            threads.user_time += metrics.resource_usage().user_time;
+            threads.system_time += metrics.resource_usage().system_time;
+        }
+    }
+};
+
+class TestOverheadReporter : public Reporter
+{
+public:
+    bool overhead = false;
+    int64_t overhead_time = 0;
+    int64_t avg_time = 0;
+    int64_t avg_time_corrected = 0;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        // Report the harness overhead of the root phase
+        if (phase.name().find('.') != std::string::npos)
+            return;
+        overhead = metrics.overhead();
+        overhead_time = metrics.overhead_time();
+        avg_time = metrics.avg_time();
+        avg_time_corrected = metrics.avg_time_corrected();
+    }
+};
+
+class TestCountersReporter : public Reporter
+{
+public:
+    std::vector<uint32_t> masks;
+
+    void ReportPhase(const PhaseCore& phase, const PhaseMetrics& metrics) override
+    {
+        uint32_t mask = 0;
+        for (int i = 0; i < Counters::COUNT; ++i)
+            if (metrics.counter_available((CounterType)i))
+                mask |= (1u << i);
+        masks.push_back(mask);
+    }
+};
+
 class TestLauncher : public Launcher
 {
 public:
@@ -140,3 +497,452 @@ TEST_CASE("Launcher complex test", "[CppBenchmark][Launcher][Reporter]")
     REQUIRE(launcher.launching() == (int)(settings.params().size() * settings.attempts()));
     REQUIRE(launcher.launching() == launcher.launched());
 }
+
+TEST_CASE("Launcher batched test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark with the last batch shorter than others
+    Settings settings = Settings().Attempts(2).Operations(10).Batch(3);
+    std::shared_ptr<TestBenchmark> benchmark = std::make_shared<TestBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Test benchmark state
+    REQUIRE(benchmark->initializations() == settings.attempts());
+    REQUIRE(benchmark->runs() == (int)(settings.attempts() * settings.operations()));
+    REQUIRE(benchmark->cleanups() == benchmark->initializations());
+}
+
+TEST_CASE("Launcher batched calibration test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark with the automatic batch size and the fixed count of operations
+    Settings settings = Settings().Attempts(2).Operations(10).Batch();
+    std::shared_ptr<TestPacedBenchmark> benchmark = std::make_shared<TestPacedBenchmark>("Test", settings, 0);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Batch calibration runs no more operations than measured
+    REQUIRE(benchmark->runs() >= (int)(settings.attempts() * settings.operations()));
+    REQUIRE(benchmark->runs() <= (int)(2 * settings.attempts() * settings.operations()));
+}
+
+TEST_CASE("Launcher clock test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmarks with the default and the time-stamp counter clocks
+    std::shared_ptr<TestBenchmark> benchmark1 = std::make_shared<TestBenchmark>("Test1", Settings().Attempts(1).Operations(10));
+    std::shared_ptr<TestBenchmark> benchmark2 = std::make_shared<TestBenchmark>("Test2", Settings().Attempts(1).Operations(10).Clock(ClockType::TSC));
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark1);
+    launcher.AddBenchmark(benchmark2);
+
+    // Launch benchmarks
+    launcher.Launch("Test[0-9]");
+
+    // Resolved clocks do not change benchmark settings
+    REQUIRE(benchmark1->settings().clock() == ClockType::Default);
+    REQUIRE(benchmark1->clock() == ClockType::Monotonic);
+    REQUIRE(benchmark2->settings().clock() == ClockType::TSC);
+    REQUIRE(benchmark2->clock() == (System::CpuInvariantTSC() ? ClockType::TSC : ClockType::Monotonic));
+}
+
+TEST_CASE("Launcher median attempt test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark with the median attempt selection
+    Settings settings = Settings().Attempts(5).Operations(3).Selection(AttemptSelection::Median);
+    std::shared_ptr<TestMedianBenchmark> benchmark = std::make_shared<TestMedianBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Report benchmarks
+    TestMedianReporter reporter;
+    launcher.Report(reporter);
+
+    // All metrics are taken from the median attempt with 5 milliseconds operations
+    REQUIRE(reporter.operations == 3);
+    REQUIRE(reporter.attempt == 3);
+    REQUIRE(reporter.min_time >= 5000000);
+    REQUIRE(reporter.max_time < 7000000);
+}
+
+TEST_CASE("Launcher adaptive test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark with unreachable precision to make the maximal count of attempts
+    Settings settings = Settings().Attempts(2, 4, 1e-9).Operations(10);
+    std::shared_ptr<TestBenchmark> benchmark = std::make_shared<TestBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Test benchmark state
+    REQUIRE(benchmark->initializations() == settings.attempts_max());
+    REQUIRE(benchmark->runs() == (int)(settings.attempts_max() * settings.operations()));
+    REQUIRE(benchmark->cleanups() == benchmark->initializations());
+
+    // Test launcher state
+    REQUIRE(launcher.launching() == settings.attempts_max());
+    REQUIRE(launcher.launching() == launcher.launched());
+}
+
+TEST_CASE("Launcher adaptive threads test", "[CppBenchmark][Launcher]")
+{
+    // Prepare threads benchmark which throughput differs a lot between attempts
+    Settings settings = Settings().Attempts(2, 4, 0.1).Threads(1).Operations(1000000);
+    std::shared_ptr<TestConvergenceBenchmark> benchmark = std::make_shared<TestConvergenceBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Convergence is checked with operations of benchmark threads, not with a single root operation per launch
+    REQUIRE(benchmark->launches() > settings.attempts());
+    REQUIRE(launcher.launching() == benchmark->launches());
+}
+
+TEST_CASE("Launcher parallel jobs test", "[CppBenchmark][Launcher]")
+{
+    // Prepare independent benchmarks
+    Settings settings = Settings().Attempts(2).Operations(10).Pair(0, 1);
+    std::vector<std::shared_ptr<TestBenchmark>> benchmarks;
+    for (int i = 0; i < 4; ++i)
+        benchmarks.push_back(std::make_shared<TestBenchmark>("Test" + std::to_string(i), settings));
+
+    // Prepare launcher with parallel jobs
+    TestLauncher launcher;
+    launcher.SetJobs(2, true);
+    for (const auto& benchmark : benchmarks)
+        launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Launch("Test[0-9]");
+
+    // Test benchmarks state
+    for (const auto& benchmark : benchmarks)
+    {
+        REQUIRE(benchmark->initializations() == settings.attempts());
+        REQUIRE(benchmark->runs() == (int)(settings.attempts() * settings.operations()));
+        REQUIRE(benchmark->cleanups() == benchmark->initializations());
+    }
+
+    // Test launcher state
+    REQUIRE(launcher.jobs() == 2);
+    REQUIRE(launcher.launching() == (int)(benchmarks.size() * settings.attempts()));
+    REQUIRE(launcher.launching() == launcher.launched());
+
+    // Benchmarks are reported in the registration order
+    std::ostringstream stream;
+    ReporterCSV reporter(stream);
+    launcher.Report(reporter);
+    std::string report = stream.str();
+    REQUIRE(report.find("Test0") < report.find("Test1"));
+    REQUIRE(report.find("Test2") < report.find("Test3"));
+}
+
+TEST_CASE("Launcher paced test", "[CppBenchmark][Launcher]")
+{
+    // Prepare open-loop benchmark with paced warmup operations
+    Settings settings = Settings().Attempts(1).Duration(1).Warmup(5).Rate(100);
+    std::shared_ptr<TestPacedBenchmark> benchmark = std::make_shared<TestPacedBenchmark>("Test", settings, 0);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    auto start = std::chrono::steady_clock::now();
+    launcher.Execute();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Operations follow the target rate during the warmup and the benchmark duration
+    REQUIRE(benchmark->runs() >= 95);
+    REQUIRE(benchmark->runs() <= 105);
+    REQUIRE(elapsed >= std::chrono::milliseconds(1000));
+    REQUIRE(elapsed < std::chrono::milliseconds(1500));
+}
+
+TEST_CASE("Launcher overloaded paced test", "[CppBenchmark][Launcher]")
+{
+    // Prepare open-loop benchmark which operations are much slower than the target rate
+    Settings settings = Settings().Attempts(1).Duration(1).Rate(1000);
+    std::shared_ptr<TestPacedBenchmark> benchmark = std::make_shared<TestPacedBenchmark>("Test", settings, 10);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    auto start = std::chrono::steady_clock::now();
+    launcher.Execute();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Benchmark stops at the deadline instead of running all operations planned for the duration
+    REQUIRE(benchmark->runs() < 110);
+    REQUIRE(elapsed < std::chrono::milliseconds(1500));
+}
+
+TEST_CASE("Launcher threads allocations test", "[CppBenchmark][Launcher]")
+{
+    Allocations::Enable();
+
+    // Prepare threads benchmark which allocates in benchmark threads only
+    Settings settings = Settings().Attempts(1).Threads(4).Operations(100);
+    std::shared_ptr<TestAllocationsBenchmark> benchmark = std::make_shared<TestAllocationsBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Root phase combines heap allocations of all benchmark threads
+    TestAllocationsReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.counters.allocations >= 400);
+    REQUIRE(reporter.counters.frees >= 400);
+    REQUIRE(reporter.counters.bytes >= 400 * 64);
+    REQUIRE(reporter.counters.peak >= 64);
+}
+
+TEST_CASE("Allocations new handler test", "[CppBenchmark][Allocations]")
+{
+    const size_t size = std::numeric_limits<size_t>::max() / 2;
+
+    // Failed allocation calls the new handler until it gives up
+    std::set_new_handler(TestNewHandler);
+    REQUIRE_THROWS_AS(Allocations::New(size), std::bad_alloc);
+    REQUIRE(new_handler_calls == 1);
+    REQUIRE(std::get_new_handler() == nullptr);
+
+    // Failed nothrow allocation returns nullptr
+    REQUIRE(Allocations::NewNoThrow(size) == nullptr);
+    REQUIRE(new_handler_calls == 1);
+
+    void* ptr = Allocations::New(64);
+    REQUIRE(ptr != nullptr);
+    Allocations::Deallocate(ptr);
+}
+
+TEST_CASE("Launcher producers/consumers latency test", "[CppBenchmark][Launcher]")
+{
+    // Prepare producers/consumers benchmark with latency histograms and interval snapshots
+    Settings settings = Settings().Attempts(1).PC(1, 1).Operations(100).Latency(1, 1000000000, 3, false).Intervals(10);
+    std::shared_ptr<TestPCBenchmark> benchmark = std::make_shared<TestPCBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Root phase combines latency and interval snapshots of producers and consumers
+    TestLatencyReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.latency);
+    REQUIRE(reporter.intervals > 0);
+}
+
+TEST_CASE("Launcher intervals capacity test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark which makes much more interval snapshots than retained
+    Settings settings = Settings().Attempts(1).Operations(50).Latency(1, 1000000000, 3).Intervals(1, 4);
+    std::shared_ptr<TestPacedBenchmark> benchmark = std::make_shared<TestPacedBenchmark>("Test", settings, 1);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Retained interval snapshots are merged and still cover all operations
+    TestIntervalsReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(!reporter.intervals.empty());
+    REQUIRE(reporter.intervals.size() <= 4);
+    int64_t operations = 0;
+    for (const auto& interval : reporter.intervals)
+    {
+        operations += interval.operations;
+        REQUIRE(interval.histogram);
+    }
+    REQUIRE(operations == reporter.operations);
+    REQUIRE(operations == 50);
+}
+
+TEST_CASE("Launcher intervals filename test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark which name contains path separators and spaces
+    Settings settings = Settings().Attempts(1).Operations(10).Intervals(1);
+    std::shared_ptr<TestPacedBenchmark> benchmark = std::make_shared<TestPacedBenchmark>("Test/intervals: 1", settings, 1);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Launch benchmarks
+    launcher.Launch("Test/intervals: 1");
+
+    // Interval snapshots are reported into the file of the current directory
+    launcher.ReportIntervals();
+    std::string filename = "Test_intervals__1";
+    REQUIRE(std::ifstream(filename + ".intervals.json").good());
+    std::remove((filename + ".intervals.json").c_str());
+    std::remove((filename + ".hlog").c_str());
+}
+
+TEST_CASE("Launcher threads fairness test", "[CppBenchmark][Launcher]")
+{
+    // Prepare threads benchmark which is unfair in each launch, but each thread is fast in some launch
+    Settings settings = Settings().Attempts(2).Threads(2).Operations(20);
+    std::shared_ptr<TestFairnessBenchmark> benchmark = std::make_shared<TestFairnessBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Fairness is estimated with threads of the same launch
+    TestFairnessReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.fairness.size() == 1);
+    REQUIRE(reporter.fairness[0].role == "thread");
+    REQUIRE(reporter.fairness[0].threads == 2);
+    REQUIRE(reporter.fairness[0].jain < 0.9);
+}
+
+TEST_CASE("Launcher threads warmup test", "[CppBenchmark][Launcher]")
+{
+    // Prepare threads benchmark with the warmup much longer than its operations
+    Settings settings = Settings().Attempts(1).Threads(2).Operations(10).WarmupDuration(200).Overhead();
+    std::shared_ptr<TestFairnessBenchmark> benchmark = std::make_shared<TestFairnessBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Warmup and calibration are not included into the running time of threads
+    TestRunningReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.threads == 2);
+    REQUIRE(reporter.running > 0);
+    REQUIRE(reporter.running < 200000000);
+}
+
+TEST_CASE("Launcher threads samples test", "[CppBenchmark][Launcher]")
+{
+    // Prepare threads benchmark with samples of each operation
+    Settings settings = Settings().Attempts(2).Threads(2).Operations(20).Samples(100);
+    std::shared_ptr<TestFairnessBenchmark> benchmark = std::make_shared<TestFairnessBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Root phase keeps samples of the selected attempt of all threads
+    TestSamplesReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.total == 40);
+    REQUIRE(reporter.samples.size() == 40);
+    std::set<uint64_t> threads;
+    for (const auto& sample : reporter.samples)
+        threads.insert(sample.thread);
+    REQUIRE(threads.size() == 2);
+}
+
+TEST_CASE("Launcher resources usage test", "[CppBenchmark][Launcher]")
+{
+    // Prepare threads benchmark which consumes CPU time
+    Settings settings = Settings().Attempts(1).Threads(2).Operations(10).Resources();
+    std::shared_ptr<TestSpinBenchmark> benchmark = std::make_shared<TestSpinBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Root phase reports the sum of resources usage of its threads
+    TestResourcesReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.count == 2);
+    REQUIRE(reporter.threads.cpu_time > 0);
+    REQUIRE((reporter.threads.user_time + reporter.threads.system_time) > 0);
+    REQUIRE(reporter.root.cpu_time == reporter.threads.cpu_time);
+    REQUIRE(reporter.root.user_time == reporter.threads.user_time);
+    REQUIRE(reporter.root.system_time == reporter.threads.system_time);
+}
+
+TEST_CASE("Launcher overhead test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark with empty operations and the harness overhead calibration
+    Settings settings = Settings().Attempts(1).Operations(100000).Overhead();
+    std::shared_ptr<TestPacedBenchmark> benchmark = std::make_shared<TestPacedBenchmark>("Test", settings, 0);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Harness overhead is measured and subtracted from the operation time
+    TestOverheadReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.overhead);
+    REQUIRE(reporter.overhead_time > 0);
+    REQUIRE(reporter.avg_time_corrected <= reporter.avg_time);
+}
+
+TEST_CASE("Launcher performance counters test", "[CppBenchmark][Launcher]")
+{
+    // Prepare benchmark with nested phases and performance counters (no counters if perf is not available)
+    Settings settings = Settings().Attempts(1).Operations(10).Pair(0, 0).Counters();
+    std::shared_ptr<TestBenchmark> benchmark = std::make_shared<TestBenchmark>("Test", settings);
+
+    // Prepare launcher
+    TestLauncher launcher;
+    launcher.AddBenchmark(benchmark);
+
+    // Execute benchmarks
+    launcher.Execute();
+
+    // Nested phases read the same performance counters as the root phase
+    TestCountersReporter reporter;
+    launcher.Report(reporter);
+    REQUIRE(reporter.masks.size() > 1);
+    for (auto mask : reporter.masks)
+        REQUIRE(mask == reporter.masks.front());
+}
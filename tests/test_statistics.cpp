@@ -0,0 +1,30 @@
+//
+// Created by CppBenchmark contributors on 17.10.2026
+//
+
+#include "test.h"
+
+#include "benchmark/statistics.h"
+
+using namespace CppBenchmark;
+
+TEST_CASE("Statistics estimators", "[CppBenchmark][Statistics]")
+{
+    std::vector<double> values = { 10.0, 12.0, 11.0, 13.0, 100.0 };
+
+    REQUIRE(Statistics::Mean(values) == 29.2);
+    REQUIRE(Statistics::Median(values) == 12.0);
+    REQUIRE(Statistics::Median({ 1.0, 2.0, 3.0, 4.0 }) == 2.5);
+    REQUIRE(Statistics::MAD(values) == 1.0);
+    REQUIRE(Statistics::CV({ 5.0, 5.0, 5.0 }) == 0.0);
+    REQUIRE(Statistics::JainIndex({ 5.0, 5.0, 5.0, 5.0 }) == 1.0);
+    REQUIRE(Statistics::JainIndex({ 8.0, 0.0, 0.0, 0.0 }) == 0.25);
+
+    std::pair<double, double> ci = Statistics::BootstrapCI(values);
+    REQUIRE(ci.first <= Statistics::Mean(values));
+    REQUIRE(ci.second >= Statistics::Mean(values));
+    REQUIRE(ci == Statistics::BootstrapCI(values));
+
+    std::vector<bool> outliers = Statistics::Outliers(values);
+    REQUIRE(outliers == std::vector<bool>({ false, false, false, false, true }));
+}
@@ -4,6 +4,7 @@
 
 #include "test.h"
 
+#include "benchmark/counters.h"
 #include "benchmark/system.h"
 
 using namespace CppBenchmark;
@@ -22,3 +23,43 @@ TEST_CASE("System information", "[CppBenchmark][System]")
     REQUIRE(System::RamTotal() >= 0);
     REQUIRE(System::RamFree() >= 0);
 }
+
+TEST_CASE("System timestamp clocks", "[CppBenchmark][System]")
+{
+    uint64_t monotonic1 = System::Timestamp(ClockType::Monotonic);
+    uint64_t monotonic2 = System::Timestamp(ClockType::Monotonic);
+    REQUIRE(monotonic2 >= monotonic1);
+
+    if (System::CpuInvariantTSC())
+    {
+        REQUIRE(System::CpuTSCFrequency() > 0);
+        REQUIRE(System::ClockFrequency(ClockType::TSC) == System::CpuTSCFrequency());
+
+        uint64_t tsc1 = System::Timestamp(ClockType::TSC);
+        uint64_t tsc2 = System::Timestamp(ClockType::TSC);
+        REQUIRE(tsc2 >= tsc1);
+    }
+
+    REQUIRE(System::ClockName(ClockType::Monotonic) == "monotonic");
+    REQUIRE(System::ClockName(ClockType::TSC) == "tsc");
+    REQUIRE(System::ClockFrequency(ClockType::Monotonic) == 1000000000);
+}
+
+TEST_CASE("Performance counters", "[CppBenchmark][System]")
+{
+    // Counters group is opened with available events only (no events if perf is not available)
+    auto group = std::make_unique<Counters>();
+    REQUIRE(group->thread() == System::CurrentThreadId());
+
+    // Values of unavailable counters are not changed
+    Counters::Values values;
+    values.fill(-1);
+    group->Read(values);
+    for (int i = 0; i < Counters::COUNT; ++i)
+        if ((group->mask() & (1u << i)) == 0)
+            REQUIRE(values[i] == -1);
+
+    // Counters group is safely closed with unavailable events
+    group.reset();
+
+}
@@ -0,0 +1,105 @@
+//
+// Created by CppBenchmark contributors on 17.10.2026
+//
+
+#include "test.h"
+
+#include "benchmark/phase_core.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace CppBenchmark;
+
+namespace {
+
+size_t Count(const std::string& text, const std::string& pattern)
+{
+    size_t result = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+        ++result;
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Phases timeline trace", "[CppBenchmark][Trace]")
+{
+    Trace::Clear();
+    Trace::Enable(16);
+
+    std::thread thread([]()
+    {
+        PhaseCore core("Trace \"benchmark\"");
+        PhaseHandle benchmark(nullptr, &core);
+        PhaseHandle phase = benchmark.ResolvePhase("Phase");
+        for (int i = 0; i < 2; ++i)
+        {
+            auto benchmark_scope = benchmark.Scope();
+            auto phase_scope = phase.Scope();
+        }
+    });
+    thread.join();
+
+    // Only 16 events fit into the buffer
+    PhaseCore core("Overflow");
+    PhaseHandle overflow(nullptr, &core);
+    for (int i = 0; i < 10; ++i)
+        auto scope = overflow.Scope();
+
+    Trace::Disable();
+    REQUIRE(!Trace::enabled());
+    REQUIRE(Trace::dropped() == 4);
+
+    std::ostringstream stream;
+    Trace::WriteJSON(stream);
+    std::string json = stream.str();
+
+    REQUIRE(json.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(Count(json, "\"name\":\"Trace \\\"benchmark\\\"\"") == 4);
+    REQUIRE(Count(json, "\"name\":\"Phase\"") == 4);
+    REQUIRE(Count(json, "\"name\":\"Overflow\"") == 16);
+    REQUIRE(Count(json, "\"ph\":\"B\"") == 12);
+    REQUIRE(Count(json, "\"ph\":\"E\"") == 12);
+
+    // Child phase is nested into its parent phase
+    REQUIRE(json.find("\"name\":\"Trace \\\"benchmark\\\"\",\"cat\":\"phase\",\"ph\":\"B\"") < json.find("\"name\":\"Phase\",\"cat\":\"phase\",\"ph\":\"B\""));
+
+    Trace::Clear();
+    REQUIRE(Trace::dropped() == 0);
+}
+
+TEST_CASE("Phases timeline trace overflow of nested phases", "[CppBenchmark][Trace]")
+{
+    Trace::Clear();
+    Trace::Enable(4);
+
+    std::thread thread([]()
+    {
+        PhaseCore core("Outer");
+        PhaseHandle outer(nullptr, &core);
+        PhaseHandle inner = outer.ResolvePhase("Inner");
+        auto outer_scope = outer.Scope();
+        for (int i = 0; i < 2; ++i)
+            auto inner_scope = inner.Scope();
+    });
+    thread.join();
+
+    Trace::Disable();
+
+    // The second inner phase does not fit with the reserved end event of the outer phase
+    REQUIRE(Trace::dropped() == 2);
+
+    std::ostringstream stream;
+    Trace::WriteJSON(stream);
+    std::string json = stream.str();
+
+    // Recorded events are paired
+    REQUIRE(Count(json, "\"name\":\"Outer\"") == 2);
+    REQUIRE(Count(json, "\"name\":\"Inner\"") == 2);
+    REQUIRE(Count(json, "\"ph\":\"B\"") == 2);
+    REQUIRE(Count(json, "\"ph\":\"E\"") == 2);
+
+    Trace::Clear();
+}
@@ -0,0 +1,137 @@
+//
+// Created by CppBenchmark contributors on 17.10.2026
+//
+
+#include "benchmark/console.h"
+#include "benchmark/metrics_export.h"
+#include "benchmark/reporter_console.h"
+#include "benchmark/version.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <thread>
+
+#include <OptionParser.h>
+
+using namespace CppBenchmark;
+
+//! Aggregated metrics of the phase of all threads
+struct TopMetrics
+{
+    std::set<uint64_t> threads;
+    int64_t calls = 0;
+    int64_t operations = 0;
+    int64_t total_time = 0;
+    int64_t max_latency = 0;
+    int64_t buckets[ExportMetrics::BUCKETS] = { 0 };
+};
+
+std::map<std::string, TopMetrics> Collect(const MetricsExport& metrics)
+{
+    std::map<std::string, TopMetrics> result;
+
+    ExportMetrics slot;
+    for (uint32_t i = 0; i < metrics.count(); ++i)
+    {
+        if (!metrics.Read(i, slot))
+            continue;
+
+        TopMetrics& phase = result[slot.name];
+        phase.threads.insert(slot.thread);
+        phase.calls += slot.calls;
+        phase.operations += slot.operations;
+        phase.total_time += slot.total_time;
+        phase.max_latency = std::max(phase.max_latency, slot.max_latency);
+        for (int j = 0; j < ExportMetrics::BUCKETS; ++j)
+            phase.buckets[j] += slot.buckets[j];
+    }
+
+    return result;
+}
+
+void Render(const MetricsExport& metrics, const std::map<std::string, TopMetrics>& current, const std::map<std::string, TopMetrics>& previous, double seconds)
+{
+    std::cout << Color::DARKGREY << ReporterConsole::GenerateSeparator('=') << std::endl;
+    std::cout << Color::WHITE << "Process: " << Color::LIGHTCYAN << metrics.process() << Color::WHITE << " Slots: " << Color::LIGHTCYAN << metrics.count() << "/" << metrics.capacity() << std::endl;
+    std::cout << Color::DARKGREY << ReporterConsole::GenerateSeparator('-') << std::endl;
+    std::cout << Color::WHITE << std::left << std::setw(32) << "Phase" << std::right << std::setw(4) << "Thr" << std::setw(12) << "Calls/s" << std::setw(11) << "Avg" << std::setw(10) << "p50" << std::setw(10) << "p99" << std::endl;
+
+    for (const auto& item : current)
+    {
+        const TopMetrics& phase = item.second;
+
+        // Calculate the delta since the previous refresh
+        TopMetrics delta = phase;
+        auto it = previous.find(item.first);
+        if (it != previous.end())
+        {
+            delta.calls -= it->second.calls;
+            delta.operations -= it->second.operations;
+            delta.total_time -= it->second.total_time;
+            for (int i = 0; i < ExportMetrics::BUCKETS; ++i)
+                delta.buckets[i] -= it->second.buckets[i];
+        }
+
+        int64_t throughput = (seconds > 0) ? (int64_t)(delta.calls / seconds) : 0;
+        int64_t average = (delta.operations > 0) ? (delta.total_time / delta.operations) : 0;
+
+        std::cout << Color::LIGHTCYAN << std::left << std::setw(32) << item.first.substr(0, 31) << std::right;
+        std::cout << Color::WHITE << std::setw(4) << phase.threads.size();
+        std::cout << Color::LIGHTGREEN << std::setw(12) << throughput;
+        std::cout << Color::YELLOW << std::setw(11) << ReporterConsole::GenerateTimePeriod(average);
+        std::cout << std::setw(10) << ReporterConsole::GenerateTimePeriod(ExportMetrics::Percentile(delta.buckets, 50.0));
+        std::cout << std::setw(10) << ReporterConsole::GenerateTimePeriod(ExportMetrics::Percentile(delta.buckets, 99.0));
+        std::cout << std::endl;
+    }
+
+    std::cout << Color::GREY;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version(version).usage("usage: %prog [options] file");
+
+    parser.add_option("-i", "--interval").dest("interval").action("store").type("int").set_default(1000).help("Refresh interval in milliseconds. Default: %default");
+    parser.add_option("-n", "--count").dest("count").action("store").type("int").set_default(0).help("Count of refreshes (0 to refresh till interrupted). Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help") || parser.args().empty())
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    int interval = std::max((int)options.get("interval"), 1);
+    int count = (int)options.get("count");
+
+    // Attach to the exported metrics region
+    MetricsExport metrics;
+    if (!metrics.Open(parser.args().front()))
+    {
+        std::cerr << "Failed to open the exported metrics file: " << parser.args().front() << std::endl;
+        return -1;
+    }
+
+    auto previous = Collect(metrics);
+    auto timestamp = std::chrono::steady_clock::now();
+
+    for (int i = 0; (count == 0) || (i < count); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+
+        auto current = Collect(metrics);
+        auto now = std::chrono::steady_clock::now();
+
+        Render(metrics, current, previous, std::chrono::duration<double>(now - timestamp).count());
+
+        previous = std::move(current);
+        timestamp = now;
+    }
+
+    return 0;
+}